@@ -0,0 +1,41 @@
+// dac_output.cpp - GP8403 SIN/COS output with change detection and bus timing
+
+#include "dac_output.h"
+
+// Same scaling as DFRobot_GP8403::setDACOutVoltage(): 12-bit code, left-aligned
+static inline uint16_t gp8403Word(uint16_t mV){
+  uint16_t code = (uint16_t)(((float)mV / GP8403_RANGE_10V) * 4095);
+  return (uint16_t)(code << 4);
+}
+
+bool DacOutput::write(uint16_t sin_mV, uint16_t cos_mV){
+  if(sin_mV == lastSin && cos_mV == lastCos){
+    stats.skipped++;
+    return false;
+  }
+
+  uint16_t s = gp8403Word(sin_mV);
+  uint16_t c = gp8403Word(cos_mV);
+
+  uint32_t t0 = micros();
+  wire->beginTransmission(addr);
+  wire->write(GP8403_REG_CH0);
+  wire->write(s & 0xFF);
+  wire->write(s >> 8);
+  wire->write(c & 0xFF);
+  wire->write(c >> 8);
+  uint8_t err = wire->endTransmission();
+  uint32_t us = micros() - t0;
+
+  stats.writes++;
+  stats.lastBusUs = us;
+  if(us > stats.maxBusUs) stats.maxBusUs = us;
+  if(err != 0){
+    stats.errors++;
+    invalidate();   // Retry on the next update even if values stay the same
+    return false;
+  }
+  lastSin = sin_mV;
+  lastCos = cos_mV;
+  return true;
+}
@@ -0,0 +1,43 @@
+#pragma once
+// dac_output.h - GP8403 SIN/COS output with change detection and bus timing
+//
+// Writes both channels in one I2C transaction (the GP8403 auto-increments
+// from the channel 0 data register into channel 1) and skips the transfer
+// entirely when neither value changed. Range/config setup stays with the
+// DFRobot_GP8403 driver; this only replaces the per-update data writes.
+
+#include <Arduino.h>
+#include <Wire.h>
+
+#define GP8403_REG_CH0     0x02    // Channel 0 data, channel 1 follows at 0x04
+#define GP8403_RANGE_10V   10000   // mV full scale in eOutputRange10V
+
+struct DacOutputStats {
+  uint32_t writes;       // I2C transactions sent
+  uint32_t skipped;      // Updates with unchanged values
+  uint32_t errors;       // endTransmission() != 0
+  uint32_t lastBusUs;    // Duration of the last transaction
+  uint32_t maxBusUs;
+};
+
+class DacOutput {
+public:
+  DacOutput(TwoWire* wire, uint8_t addr = 0) : stats(), wire(wire), addr(addr) { invalidate(); }
+
+  // Set SIN (channel 0) and COS (channel 1). Returns true if a transfer was made.
+  bool write(uint16_t sin_mV, uint16_t cos_mV);
+
+  // Force the next write() onto the bus (after DAC reset or init)
+  void invalidate() { lastSin = 0xFFFF; lastCos = 0xFFFF; }
+
+  uint8_t address() const { return addr; }
+  void setAddress(uint8_t a) { addr = a; invalidate(); }
+
+  DacOutputStats stats;
+
+private:
+  TwoWire* wire;
+  uint8_t addr;
+  uint16_t lastSin;
+  uint16_t lastCos;
+};
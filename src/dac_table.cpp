@@ -0,0 +1,30 @@
+// dac_table.cpp - Precomputed SIN/COS DAC millivolts per tenth of a degree
+
+#include "dac_table.h"
+#include <math.h>
+
+// Same constant as Arduino's DEG_TO_RAD (a double), so the product rounds alike
+#define DAC_DEG_TO_RAD  0.017453292519943295769236907684886
+
+static inline int mvClamp(int mv, const DacCal& cal){
+  if(mv<cal.vmin) return cal.vmin;
+  if(mv>cal.vmax) return cal.vmax;
+  return mv;
+}
+
+DacPair dacMathMv(int step, const DacCal& cal){
+  // step/STEPS is exact for whole degrees, keeping those bit-identical
+  float r = ((double)step / DAC_TABLE_STEPS) * DAC_DEG_TO_RAD;
+  float s = sinf(r), c = cosf(r);
+  float amp = cal.vamp;
+  DacPair p;
+  p.sin_mV = (uint16_t)mvClamp(cal.vcen + (int)lroundf(amp * s), cal);
+  p.cos_mV = (uint16_t)mvClamp(cal.vcen + (int)lroundf(amp * c), cal);
+  return p;
+}
+
+void dacTableBuild(DacPair* table, const DacCal& cal){
+  for(int i = 0; i < DAC_TABLE_SIZE; i++){
+    table[i] = dacMathMv(i, cal);
+  }
+}
@@ -0,0 +1,40 @@
+#pragma once
+// dac_table.h - Precomputed SIN/COS DAC millivolts per tenth of a degree
+//
+// Pure C/C++ like nmea_parser.h so the host test can check the table against
+// the float math it replaces. Built once at startup and again only when the
+// voltage calibration changes; display offsets are applied before lookup.
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define DAC_TABLE_STEPS  10                      // Entries per degree
+#define DAC_TABLE_SIZE   (360 * DAC_TABLE_STEPS) // 0.1 deg ~ 1.4 DAC codes at full amplitude
+
+// Voltage calibration (mV)
+struct DacCal {
+  int vmin;
+  int vcen;
+  int vamp;
+  int vmax;
+};
+
+struct DacPair {
+  uint16_t sin_mV;
+  uint16_t cos_mV;
+};
+
+// Reference float path; `step` is in 1/DAC_TABLE_STEPS degrees. For whole
+// degrees this is exactly what setOutputsDeg used to do per sentence.
+DacPair dacMathMv(int step, const DacCal& cal);
+
+// Fill table[DAC_TABLE_SIZE] from the reference path
+void dacTableBuild(DacPair* table, const DacCal& cal);
+
+// adjCdeg must already be wrapped to 0..35999 centidegrees
+static inline DacPair dacTableLookup(const DacPair* table, int32_t adjCdeg){
+  const int32_t cPerStep = 100 / DAC_TABLE_STEPS;
+  int32_t i = (adjCdeg + cPerStep/2) / cPerStep;
+  if(i >= DAC_TABLE_SIZE) i -= DAC_TABLE_SIZE;
+  return table[i];
+}
@@ -0,0 +1,26 @@
+#include "dds_engine.h"
+
+void ddsAttach(DdsEngine& e, int slot, int gpio){
+  if (slot < 0 || slot >= DDS_MAX_OUTPUTS || gpio < 0 || gpio > 63) return;
+  DdsOutput& o = e.out[slot];
+  o.incr = 0;
+  o.dutyPhase = 0;
+  o.phase = 0;
+  o.pinMask = 1ULL << gpio;
+}
+
+void ddsDetach(DdsEngine& e, int slot){
+  if (slot < 0 || slot >= DDS_MAX_OUTPUTS) return;
+  e.out[slot].incr = 0;
+  e.out[slot].pinMask = 0;   // Next tick clears the pin if it was high
+}
+
+void ddsSet(DdsEngine& e, int slot, uint32_t mHz, int dutyPct){
+  if (slot < 0 || slot >= DDS_MAX_OUTPUTS) return;
+  if (dutyPct < 0) dutyPct = 0;
+  if (dutyPct > 100) dutyPct = 100;
+  DdsOutput& o = e.out[slot];
+  // Duty first: a tick between the two stores sees the new duty at the old rate
+  o.dutyPhase = dutyPct >= 100 ? 0xFFFFFFFFu : (uint32_t)(((uint64_t)dutyPct << 32) / 100);
+  o.incr = ddsIncr(mHz);
+}
@@ -0,0 +1,54 @@
+#pragma once
+// dds_engine.h - Phase-accumulator pulse generator for all displays
+//
+// One periodic timer interrupt advances a 32-bit phase per output and turns
+// the GPIO on while the phase is below the duty threshold. Frequencies are
+// exact to Fs/2^32 (~5 uHz), changes are phase-continuous, and no LEDC
+// channel or timer is used, so outputs are limited only by DDS_MAX_OUTPUTS.
+// Edges land on the tick grid: 1/DDS_TICK_HZ = 50 us of jitter.
+//
+// ddsTick() is header-inline so the ISR gets its own IRAM copy; pure C/C++
+// otherwise, so the host test can run the same code tick by tick.
+
+#include <stdint.h>
+
+#define DDS_TICK_HZ      20000     // Timer interrupt rate
+#define DDS_MAX_OUTPUTS  8
+
+struct DdsOutput {
+  volatile uint32_t incr;        // Phase step per tick, 0 = off
+  volatile uint32_t dutyPhase;   // High while phase < dutyPhase
+  uint32_t phase;
+  uint64_t pinMask;              // 1 << gpio, 0 = unused slot
+};
+
+struct DdsEngine {
+  DdsOutput out[DDS_MAX_OUTPUTS];
+  uint64_t level;                // Pins currently driven high
+};
+
+// Phase step for a frequency in mHz, rounded to the nearest ~5 uHz
+static inline uint32_t ddsIncr(uint32_t mHz){
+  const uint64_t den = (uint64_t)DDS_TICK_HZ * 1000;
+  return (uint32_t)((((uint64_t)mHz << 32) + den / 2) / den);
+}
+
+// Advance every slot one tick. Returns the pins to set / clear; the caller
+// writes them to the GPIO registers. Fixed loop, no branches on history.
+static inline __attribute__((always_inline)) void ddsTick(DdsEngine& e, uint64_t& setMask, uint64_t& clrMask){
+  uint64_t high = 0;
+  for (int i = 0; i < DDS_MAX_OUTPUTS; i++) {
+    DdsOutput& o = e.out[i];
+    uint32_t inc = o.incr;
+    o.phase += inc;
+    if (inc && o.phase < o.dutyPhase) high |= o.pinMask;
+  }
+  setMask = high & ~e.level;
+  clrMask = e.level & ~high;
+  e.level = high;
+}
+
+// Output-task side; single 32-bit stores the ISR can read at any time
+void ddsAttach(DdsEngine& e, int slot, int gpio);
+void ddsDetach(DdsEngine& e, int slot);
+void ddsSet(DdsEngine& e, int slot, uint32_t mHz, int dutyPct);
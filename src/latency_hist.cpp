@@ -0,0 +1,32 @@
+// latency_hist.cpp - Fixed-bucket latency histograms for hot-path stages
+
+#include "latency_hist.h"
+
+uint32_t LatencyHist::percentile(uint32_t p) const {
+  if(count == 0) return 0;
+  // Rank of the wanted sample, 1-based, rounded up
+  uint64_t rank = ((uint64_t)count * p + 99) / 100;
+  if(rank == 0) rank = 1;
+  uint64_t seen = 0;
+  for(uint32_t b = 0; b < HIST_BUCKETS; b++){
+    seen += buckets[b];
+    if(seen >= rank){
+      uint32_t hi = (b + 1 < HIST_BUCKETS) ? histBucketLow(b + 1) - 1 : UINT32_MAX;
+      if(hi > maxV) hi = maxV;
+      if(hi < minV) hi = minV;
+      return hi;
+    }
+  }
+  return maxV;
+}
+
+LatencySummary LatencyHist::summary() const {
+  LatencySummary s;
+  s.count = count;
+  s.min = count ? minV : 0;
+  s.max = maxV;
+  s.avg = count ? (uint32_t)(sum / count) : 0;
+  s.p50 = percentile(50);
+  s.p99 = percentile(99);
+  return s;
+}
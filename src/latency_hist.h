@@ -0,0 +1,91 @@
+#pragma once
+// latency_hist.h - Fixed-bucket latency histograms for hot-path stages
+//
+// Log-linear buckets (4 per power of two, so percentiles are within 25%)
+// over raw CPU cycles; converting to µs happens only when reporting. Pure
+// C/C++ so the host tests can check the bucket math. Recording is a few
+// integer ops and never allocates. Counters are not atomic: each stage is
+// recorded from one task, and a reset racing a record only skews one sample.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#define HIST_SUB_BITS  2
+#define HIST_SUB       (1u << HIST_SUB_BITS)
+#define HIST_BUCKETS   ((32 - HIST_SUB_BITS + 1) * HIST_SUB)
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#define HIST_CYCLES()  ESP.getCycleCount()
+#else
+#include <chrono>
+#define HIST_CYCLES()  ((uint32_t)std::chrono::duration_cast<std::chrono::nanoseconds>( \
+                         std::chrono::steady_clock::now().time_since_epoch()).count())
+#endif
+
+static inline uint32_t histBucket(uint32_t v){
+  if(v < HIST_SUB) return v;
+  uint32_t msb = 31 - __builtin_clz(v);
+  uint32_t sub = (v >> (msb - HIST_SUB_BITS)) & (HIST_SUB - 1);
+  return (msb - HIST_SUB_BITS + 1) * HIST_SUB + sub;
+}
+
+// Smallest value that lands in bucket b
+static inline uint32_t histBucketLow(uint32_t b){
+  if(b < HIST_SUB) return b;
+  uint32_t msb = b / HIST_SUB + HIST_SUB_BITS - 1;
+  return (1u << msb) | ((b % HIST_SUB) << (msb - HIST_SUB_BITS));
+}
+
+struct LatencySummary {
+  uint32_t count;
+  uint32_t min;
+  uint32_t avg;
+  uint32_t p50;
+  uint32_t p99;
+  uint32_t max;
+};
+
+class LatencyHist {
+public:
+  LatencyHist() { reset(); }
+
+  void record(uint32_t v){
+    buckets[histBucket(v)]++;
+    count++;
+    sum += v;
+    if(v < minV) minV = v;
+    if(v > maxV) maxV = v;
+  }
+
+  void reset(){
+    memset(buckets, 0, sizeof(buckets));
+    count = 0;
+    sum = 0;
+    minV = UINT32_MAX;
+    maxV = 0;
+  }
+
+  // Percentile p in 0..100; upper edge of the bucket, clamped to min/max
+  uint32_t percentile(uint32_t p) const;
+
+  LatencySummary summary() const;
+
+private:
+  uint32_t buckets[HIST_BUCKETS];
+  uint32_t count;
+  uint64_t sum;
+  uint32_t minV;
+  uint32_t maxV;
+};
+
+// Scope timer: records elapsed cycles into a histogram on destruction
+class StageTimer {
+public:
+  explicit StageTimer(LatencyHist& h) : hist(h), t0(HIST_CYCLES()) {}
+  ~StageTimer() { hist.record(HIST_CYCLES() - t0); }
+private:
+  LatencyHist& hist;
+  uint32_t t0;
+};
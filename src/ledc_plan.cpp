@@ -0,0 +1,22 @@
+#include "ledc_plan.h"
+
+bool ledcPlanFor(uint32_t mHz, uint8_t minBits, LedcPlan& plan){
+  if (mHz == 0) return false;
+  // div = clk / (f * 2^bits); in Q8 and with f in mHz: clk * 256000 / (mHz << bits)
+  const uint64_t num = (uint64_t)LEDC_PLAN_CLK_HZ * 256000ULL;
+  for (uint8_t bits = minBits; bits <= LEDC_PLAN_BITS_MAX; bits++) {
+    uint64_t den = (uint64_t)mHz << bits;
+    uint64_t div = (num + den / 2) / den;
+    if (div < LEDC_PLAN_DIV_MIN) return false;   // Too fast even at minBits
+    if (div <= LEDC_PLAN_DIV_MAX) {
+      plan.divQ8 = (uint32_t)div;
+      plan.bits = bits;
+      return true;
+    }
+  }
+  return false;                                   // Too slow even at 20 bits
+}
+
+double ledcPlanHz(const LedcPlan& plan){
+  return (double)LEDC_PLAN_CLK_HZ * 256.0 / ((double)plan.divQ8 * (double)(1UL << plan.bits));
+}
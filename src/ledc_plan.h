@@ -0,0 +1,32 @@
+#pragma once
+// ledc_plan.h - LEDC timer settings for a fractional output frequency
+//
+// The LEDC timer divides its source clock by a 10.8 fixed-point divider and
+// then by 2^bits (the duty resolution). ledcChangeFrequency() only takes whole
+// Hz, so a Sumlog at K=0.5 and 1.3 kn gets 1 Hz instead of 0.65 Hz and reads
+// 0 below 0.5 Hz. Picking the divider and resolution here gives ~4 ppm steps
+// from 0.075 Hz up. Pure C/C++ so the host test can model the achieved rate.
+
+#include <stdint.h>
+
+#define LEDC_PLAN_CLK_HZ     80000000UL   // APB clock
+#define LEDC_PLAN_DIV_MIN    0x100        // 1.0 in 10.8 fixed point
+#define LEDC_PLAN_DIV_MAX    0x3FFFF      // 1023.996
+#define LEDC_PLAN_BITS_MAX   20
+
+struct LedcPlan {
+  uint32_t divQ8;   // Clock divider, 10.8 fixed point
+  uint8_t bits;     // Duty resolution
+};
+
+// Lowest resolution >= minBits whose divider fits; the largest divider gives
+// the finest frequency step. False when mHz is outside the LEDC range.
+bool ledcPlanFor(uint32_t mHz, uint8_t minBits, LedcPlan& plan);
+
+// Frequency the timer actually runs at, in Hz
+double ledcPlanHz(const LedcPlan& plan);
+
+// Duty count for a percentage at the plan's resolution
+static inline uint32_t ledcPlanDuty(const LedcPlan& plan, int dutyPct){
+  return (uint32_t)((((1u << plan.bits) - 1) * (uint32_t)dutyPct) / 100);
+}
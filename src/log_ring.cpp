@@ -0,0 +1,62 @@
+// log_ring.cpp - Deferred formatting for log records
+
+#include "log_ring.h"
+#include <stdio.h>
+#include <string.h>
+
+LogRing logRing;
+
+char logLevelChar(uint8_t level){
+  switch(level){
+    case LOG_LEVEL_ERROR: return 'E';
+    case LOG_LEVEL_WARN:  return 'W';
+    case LOG_LEVEL_INFO:  return 'I';
+    case LOG_LEVEL_DEBUG: return 'D';
+    default:              return '?';
+  }
+}
+
+size_t logFormat(const LogRecord& rec, char* out, size_t size){
+  if(size == 0) return 0;
+  size_t n = 0;
+  uint8_t argi = 0;
+  const char* p = rec.fmt;
+
+  while(*p && n < size - 1){
+    if(*p != '%'){ out[n++] = *p++; continue; }
+    if(p[1] == '%'){ out[n++] = '%'; p += 2; continue; }
+
+    // Copy flags/width/precision, drop length modifiers
+    char spec[16];
+    size_t sl = 0;
+    spec[sl++] = *p++;
+    while(*p && strchr("-+ #0123456789.", *p) && sl < sizeof(spec) - 2) spec[sl++] = *p++;
+    while(*p && strchr("hlLzjt", *p)) p++;
+    char conv = *p;
+    if(!conv) break;
+    p++;
+    spec[sl++] = conv;
+    spec[sl] = 0;
+
+    if(argi >= rec.nargs){ continue; }      // Missing argument: print nothing
+    const LogArg& a = rec.args[argi++];
+    size_t room = size - n;
+    int w;
+    switch(conv){
+      case 'd': case 'i': case 'c':
+        w = snprintf(out + n, room, spec, (int)a.i); break;
+      case 'u': case 'x': case 'X': case 'o':
+        w = snprintf(out + n, room, spec, (unsigned)a.u); break;
+      case 'f': case 'F': case 'e': case 'E': case 'g': case 'G':
+        w = snprintf(out + n, room, spec, (double)a.f); break;
+      case 's':
+        w = snprintf(out + n, room, spec, a.s ? a.s : "(null)"); break;
+      default:
+        w = 0; break;
+    }
+    if(w < 0) w = 0;
+    n += ((size_t)w < room) ? (size_t)w : room - 1;
+  }
+  out[n] = 0;
+  return n;
+}
@@ -0,0 +1,153 @@
+#pragma once
+// log_ring.h - Lock-free binary log records, formatted later by a low-priority task
+//
+// Hot paths only store (time, level, format pointer, up to 4 args) into a
+// bounded multi-producer ring: no formatting and no UART wait. The logger
+// task drains the ring and does the printf work. The format string and any
+// %s argument must outlive the record (string literals, global buffers).
+// Records below LOG_LEVEL compile to nothing; a full ring drops the new
+// record and counts it.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+#define LOG_LEVEL_NONE   0
+#define LOG_LEVEL_ERROR  1
+#define LOG_LEVEL_WARN   2
+#define LOG_LEVEL_INFO   3
+#define LOG_LEVEL_DEBUG  4
+
+// Release default; build with -DLOG_LEVEL=LOG_LEVEL_DEBUG for debug records
+#ifndef LOG_LEVEL
+#define LOG_LEVEL  LOG_LEVEL_INFO
+#endif
+
+#define LOG_RING_SLOTS  64   // Power of two
+#define LOG_MAX_ARGS    4
+
+#ifdef ARDUINO
+#include <Arduino.h>
+#define LOG_CLOCK_MS()  millis()
+#else
+#include <chrono>
+#define LOG_CLOCK_MS()  ((uint32_t)std::chrono::duration_cast<std::chrono::milliseconds>( \
+                          std::chrono::steady_clock::now().time_since_epoch()).count())
+#endif
+
+union LogArg {
+  int32_t i;
+  uint32_t u;
+  float f;
+  const char* s;
+};
+
+struct LogRecord {
+  uint32_t ms;
+  uint8_t level;
+  uint8_t nargs;
+  const char* fmt;
+  LogArg args[LOG_MAX_ARGS];
+};
+
+// Bounded MPSC queue (per-slot sequence numbers): any task may push, the
+// logger task pops
+class LogRing {
+public:
+  LogRing() {
+    for (uint32_t i = 0; i < LOG_RING_SLOTS; i++) cells[i].seq.store(i, std::memory_order_relaxed);
+  }
+
+  bool push(const LogRecord& rec) {
+    uint32_t pos = head.load(std::memory_order_relaxed);
+    Cell* c;
+    for (;;) {
+      c = &cells[pos & (LOG_RING_SLOTS - 1)];
+      int32_t diff = (int32_t)(c->seq.load(std::memory_order_acquire) - pos);
+      if (diff == 0) {
+        if (head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+      } else if (diff < 0) {
+        dropped.fetch_add(1, std::memory_order_relaxed);   // Full
+        return false;
+      } else {
+        pos = head.load(std::memory_order_relaxed);
+      }
+    }
+    c->rec = rec;
+    c->seq.store(pos + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Single consumer
+  bool pop(LogRecord& rec) {
+    Cell* c = &cells[tail & (LOG_RING_SLOTS - 1)];
+    if ((int32_t)(c->seq.load(std::memory_order_acquire) - (tail + 1)) < 0) return false;
+    rec = c->rec;
+    c->seq.store(tail + LOG_RING_SLOTS, std::memory_order_release);
+    tail++;
+    return true;
+  }
+
+  std::atomic<uint32_t> dropped{0};
+
+private:
+  struct Cell {
+    std::atomic<uint32_t> seq;
+    LogRecord rec;
+  };
+  Cell cells[LOG_RING_SLOTS];
+  std::atomic<uint32_t> head{0};
+  uint32_t tail = 0;
+};
+
+extern LogRing logRing;
+
+// Argument capture: 32-bit ints, floats (doubles are narrowed) and strings
+static inline LogArg logArg(int v)           { LogArg a; a.i = v; return a; }
+static inline LogArg logArg(long v)          { LogArg a; a.i = (int32_t)v; return a; }
+static inline LogArg logArg(unsigned v)      { LogArg a; a.u = v; return a; }
+static inline LogArg logArg(unsigned long v) { LogArg a; a.u = (uint32_t)v; return a; }
+static inline LogArg logArg(float v)         { LogArg a; a.f = v; return a; }
+static inline LogArg logArg(double v)        { LogArg a; a.f = (float)v; return a; }
+static inline LogArg logArg(const char* v)   { LogArg a; a.s = v; return a; }
+
+template <typename... A>
+static inline void logWrite(uint8_t level, const char* fmt, A... a) {
+  static_assert(sizeof...(A) <= LOG_MAX_ARGS, "too many log arguments");
+  LogRecord r;
+  r.ms = LOG_CLOCK_MS();
+  r.level = level;
+  r.nargs = (uint8_t)sizeof...(A);
+  r.fmt = fmt;
+  LogArg args[sizeof...(A) + 1] = { logArg(a)... };
+  for (size_t i = 0; i < sizeof...(A); i++) r.args[i] = args[i];
+  logRing.push(r);
+}
+
+// Render a record's message (printf subset: d i u x X c f e g s %, flags and
+// width/precision; length modifiers are accepted and ignored). Returns length.
+size_t logFormat(const LogRecord& rec, char* out, size_t size);
+
+// One-letter level tag: E W I D
+char logLevelChar(uint8_t level);
+
+#if LOG_LEVEL >= LOG_LEVEL_ERROR
+#define LOG_ERROR(fmt, ...)  logWrite(LOG_LEVEL_ERROR, fmt, ##__VA_ARGS__)
+#else
+#define LOG_ERROR(fmt, ...)  do {} while (0)
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_WARN
+#define LOG_WARN(fmt, ...)   logWrite(LOG_LEVEL_WARN, fmt, ##__VA_ARGS__)
+#else
+#define LOG_WARN(fmt, ...)   do {} while (0)
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_INFO
+#define LOG_INFO(fmt, ...)   logWrite(LOG_LEVEL_INFO, fmt, ##__VA_ARGS__)
+#else
+#define LOG_INFO(fmt, ...)   do {} while (0)
+#endif
+#if LOG_LEVEL >= LOG_LEVEL_DEBUG
+#define LOG_DEBUG(fmt, ...)  logWrite(LOG_LEVEL_DEBUG, fmt, ##__VA_ARGS__)
+#else
+#define LOG_DEBUG(fmt, ...)  do {} while (0)
+#endif
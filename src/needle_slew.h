@@ -0,0 +1,41 @@
+#pragma once
+// needle_slew.h - Slew-limited angle interpolation in centidegrees
+//
+// Integer-only so the output task can run it at hundreds of Hz. Moves along
+// the shorter way round the dial (359 -> 1 passes through 0).
+
+#include <stdint.h>
+#include "nmea_parser.h"
+
+#define OUTPUT_RATE_HZ_DEFAULT  200   // Output task needle (DAC) update rate
+#define OUTPUT_RATE_HZ_MIN      10
+#define OUTPUT_RATE_HZ_MAX      500
+#define SLEW_DPS_DEFAULT        180   // Needle slew limit, deg/s
+
+#define NEEDLE_UNSET  (-1)   // Needle not driven yet or parked: next step jumps
+
+// Signed shortest difference target - cur, in -17999..18000
+static inline int32_t angleDiffCdeg(int32_t cur, int32_t target){
+  int32_t d = wrap36000(target - cur);
+  return d > 18000 ? d - 36000 : d;
+}
+
+// One interpolation tick: move cur toward target by at most maxStep (> 0)
+static inline int32_t slewTowardCdeg(int32_t cur, int32_t target, int32_t maxStep){
+  int32_t d = angleDiffCdeg(cur, target);
+  if(d > maxStep) d = maxStep;
+  else if(d < -maxStep) d = -maxStep;
+  return wrap36000(cur + d);
+}
+
+// Output task step: jump from NEEDLE_UNSET, otherwise slew
+static inline int32_t needleStepCdeg(int32_t needle, int32_t target, int32_t maxStep){
+  return needle < 0 ? target : slewTowardCdeg(needle, target, maxStep);
+}
+
+// Max step per tick for a slew rate (deg/s) at a tick rate (Hz); 0 = no limit
+static inline int32_t slewStepCdeg(uint32_t slewDps, uint32_t rateHz){
+  if(slewDps == 0 || rateHz == 0) return 36000;
+  int32_t step = (int32_t)((slewDps * 100u) / rateHz);
+  return step > 0 ? step : 1;
+}
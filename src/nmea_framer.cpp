@@ -0,0 +1,116 @@
+// nmea_framer.cpp - Byte-at-a-time NMEA 0183 line framer
+
+#include "nmea_framer.h"
+
+static inline int hexNibble(char c){
+  if(c>='0' && c<='9') return c-'0';
+  if(c>='A' && c<='F') return c-'A'+10;
+  if(c>='a' && c<='f') return c-'a'+10;
+  return -1;
+}
+
+void NmeaFramer::reset(){
+  len = 0;
+  buf[0] = 0;
+  state = WAIT_START;
+  cs = 0;
+  want = 0;
+  checksummed = false;
+}
+
+void NmeaFramer::begin(char c){
+  buf[0] = c;
+  len = 1;
+  cs = 0;
+  checksummed = false;
+  state = BODY;
+}
+
+bool NmeaFramer::finish(){
+  buf[len] = 0;
+  state = WAIT_START;
+  stats.lines++;
+  return true;
+}
+
+void NmeaFramer::drop(uint32_t& counter){
+  counter++;
+  len = 0;
+  buf[0] = 0;
+  state = DISCARD;
+}
+
+bool NmeaFramer::push(char c){
+  stats.bytes++;
+  return step(c);
+}
+
+bool NmeaFramer::endOfPacket(){
+  if(state==WAIT_START) return false;
+  bool done = step('\n');
+  state = WAIT_START;
+  return done;
+}
+
+bool NmeaFramer::step(char c){
+  bool eol = (c=='\r' || c=='\n');
+
+  switch(state){
+    case WAIT_START:
+      if(c=='$' || c=='!') begin(c);
+      return false;
+
+    case DISCARD:
+      // A new start char resyncs immediately (lost CR/LF)
+      if(c=='$' || c=='!') begin(c);
+      else if(eol) state = WAIT_START;
+      return false;
+
+    case BODY:
+      if(eol){
+        // No checksum: accepted as before, the parser sanity-checks fields
+        if(len<6){ len = 0; state = WAIT_START; return false; }
+        return finish();
+      }
+      if(c=='$' || c=='!'){
+        stats.corrupted++;
+        begin(c);
+        return false;
+      }
+      if(len >= NMEA_LINE_MAX-4){          // Leave room for "*hh" + NUL
+        drop(stats.overruns);
+        return false;
+      }
+      buf[len++] = c;
+      if(c=='*') state = CS_HI;
+      else cs ^= (uint8_t)c;
+      return false;
+
+    case CS_HI: {
+      int v = hexNibble(c);
+      if(v<0){ drop(stats.corrupted); if(eol) state = WAIT_START; return false; }
+      want = (uint8_t)(v<<4);
+      buf[len++] = c;
+      state = CS_LO;
+      return false;
+    }
+
+    case CS_LO: {
+      int v = hexNibble(c);
+      if(v<0){ drop(stats.corrupted); if(eol) state = WAIT_START; return false; }
+      want |= (uint8_t)v;
+      buf[len++] = c;
+      if(want != cs){ drop(stats.badChecksum); return false; }
+      checksummed = true;
+      state = WAIT_EOL;
+      return false;
+    }
+
+    case WAIT_EOL:
+      if(eol) return finish();
+      if(c=='$' || c=='!'){ stats.corrupted++; begin(c); return false; }
+      drop(stats.corrupted);
+      return false;
+  }
+  return false;
+}
@@ -0,0 +1,64 @@
+#pragma once
+// nmea_framer.h - Byte-at-a-time NMEA 0183 line framer
+//
+// Validates while bytes arrive: start character, XOR checksum and the '*hh'
+// trailer are checked on the fly, so a line handed out by push() is already
+// known-good. Over-long and corrupted lines are dropped (and counted) as soon
+// as the problem is seen instead of being truncated and parsed anyway.
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define NMEA_LINE_MAX  256   // Incl. NUL; NMEA 0183 allows 82 chars
+
+struct NmeaFramerStats {
+  uint32_t lines;          // Validated lines handed out
+  uint32_t overruns;       // Longer than NMEA_LINE_MAX - dropped
+  uint32_t badChecksum;    // '*hh' did not match
+  uint32_t corrupted;      // Restarted mid-line, bad hex, junk after checksum
+  uint32_t bytes;          // All bytes fed in
+};
+
+class NmeaFramer {
+public:
+  NmeaFramer() : stats() { reset(); }
+
+  // Feed one byte. Returns true when a complete, validated line is ready;
+  // it stays readable through line()/length() until the next push().
+  bool push(char c);
+
+  // Datagram boundary: finish a pending line as if CR/LF had arrived, so
+  // a UDP packet without line ending is never spliced into the next one.
+  bool endOfPacket();
+
+  // Forget any partial line (e.g. after a reconnect)
+  void reset();
+
+  const char* line() const { return buf; }
+  size_t length() const { return len; }
+  bool hadChecksum() const { return checksummed; }
+
+  NmeaFramerStats stats;
+
+private:
+  enum State : uint8_t {
+    WAIT_START,    // Skipping until '$' or '!'
+    BODY,          // Inside sentence, XOR-ing bytes
+    CS_HI,         // After '*'
+    CS_LO,
+    WAIT_EOL,      // Checksum matched, expecting CR/LF
+    DISCARD        // Bad line, skip to end of line
+  };
+
+  bool step(char c);
+  void begin(char c);
+  bool finish();
+  void drop(uint32_t& counter);
+
+  char buf[NMEA_LINE_MAX];
+  size_t len;
+  State state;
+  uint8_t cs;
+  uint8_t want;
+  bool checksummed;
+};
@@ -0,0 +1,246 @@
+// nmea_parser.cpp - NMEA 0183 wind sentence parsing (MWV, VWR, VWT)
+//
+// One pass over the line records field offsets and the XOR checksum, the
+// 3-char formatter picks a handler from a small hash table, and numbers go
+// through a fixed-point decimal parser instead of atof().
+
+#include "nmea_parser.h"
+#include <string.h>
+
+const char* nmeaKindName(NmeaWindKind kind){
+  switch(kind){
+    case NMEA_KIND_MWV_R: return "MWV(R)";
+    case NMEA_KIND_MWV_T: return "MWV(T)";
+    case NMEA_KIND_VWR:   return "VWR";
+    case NMEA_KIND_VWT:   return "VWT";
+    default:              return "-";
+  }
+}
+
+static inline int hexVal(char c){
+  if(c>='0' && c<='9') return c-'0';
+  if(c>='A' && c<='F') return c-'A'+10;
+  if(c>='a' && c<='f') return c-'a'+10;
+  return -1;
+}
+
+// verify = false: the line comes from NmeaFramer, which has checked it
+static inline bool tokenize(const char* line, size_t len, NmeaTokens& t, bool verify){
+  if(len<6 || (line[0]!='$' && line[0]!='!')) return false;
+  t.line = line;
+  t.count = 0;
+  t.hasChecksum = false;
+  t.checksumOk = true;
+
+  uint8_t cs = 0;
+  size_t fieldStart = 1;
+  size_t i = 1;
+  for(; i<len; i++){
+    char c = line[i];
+    if(c=='*') break;
+    if(verify) cs ^= (uint8_t)c;
+    if(c==','){
+      if(t.count<NMEA_MAX_FIELDS){
+        t.start[t.count] = (uint16_t)fieldStart;
+        t.len[t.count]   = (uint16_t)(i-fieldStart);
+        t.count++;
+      }
+      fieldStart = i+1;
+    }
+  }
+  if(t.count<NMEA_MAX_FIELDS){
+    t.start[t.count] = (uint16_t)fieldStart;
+    t.len[t.count]   = (uint16_t)(i-fieldStart);
+    t.count++;
+  }
+
+  if(!verify){
+    t.hasChecksum = i<len;
+    return true;
+  }
+  // "*hh" - a missing or truncated checksum is accepted as before
+  if(i+2<len){
+    int hi = hexVal(line[i+1]), lo = hexVal(line[i+2]);
+    if(hi>=0 && lo>=0){
+      t.hasChecksum = true;
+      t.checksumOk = (cs == (uint8_t)((hi<<4)|lo));
+    }
+  }
+  return true;
+}
+
+bool nmeaTokenize(const char* line, size_t len, NmeaTokens& t){
+  return tokenize(line, len, t, true);
+}
+
+bool nmeaParseFixed(const char* s, size_t len, uint8_t decimals, int32_t& out){
+  size_t i = 0;
+  bool neg = false;
+  if(i<len && (s[i]=='-' || s[i]=='+')){ neg = (s[i]=='-'); i++; }
+
+  int32_t v = 0;
+  uint8_t frac = 0;
+  bool dot = false, digits = false;
+  for(; i<len; i++){
+    char c = s[i];
+    if(c=='.'){
+      if(dot) return false;
+      dot = true;
+      continue;
+    }
+    if(c<'0' || c>'9') return false;
+    digits = true;
+    if(!dot){
+      if(v > 9999999) return false;      // Way outside any wind value
+      v = v*10 + (c-'0');
+    } else if(frac<decimals){
+      v = v*10 + (c-'0');
+      frac++;
+    }
+    // Further decimals are dropped: truncating here keeps a later
+    // round-to-whole-degree identical to lroundf() of the full value
+  }
+  if(!digits) return false;
+  for(; frac<decimals; frac++) v *= 10;
+  out = neg ? -v : v;
+  return true;
+}
+
+/* ========= Sentence handlers ========= */
+typedef NmeaParseResult (*SentenceHandler)(const NmeaTokens& t, WindSample& out);
+
+static inline const char* field(const NmeaTokens& t, int i){ return t.line + t.start[i]; }
+
+static inline char fieldChar(const NmeaTokens& t, int i){
+  if(i>=t.count || t.len[i]==0) return 0;
+  char c = field(t, i)[0];
+  return (c>='a' && c<='z') ? (char)(c-'a'+'A') : c;
+}
+
+// Optional speed field shared by MWV/VWR/VWT (knots, sanity-limited)
+static void parseSpeedField(const NmeaTokens& t, WindSample& out){
+  out.speedKn = 0.0f;
+  out.hasSpeed = false;
+  int32_t ckn;
+  if(t.count>=4 && nmeaParseFixed(field(t, 3), t.len[3], 2, ckn) && ckn>=0 && ckn<20000){
+    out.speedKn = ckn / 100.0f;
+    out.hasSpeed = true;
+  }
+}
+
+static NmeaParseResult handleMWV(const NmeaTokens& t, WindSample& out){
+  if(t.count<3) return NMEA_MALFORMED;
+  int32_t cdeg;
+  if(!nmeaParseFixed(field(t, 1), t.len[1], 2, cdeg)) return NMEA_MALFORMED;
+  char ref = fieldChar(t, 2);
+  if(ref!='R' && ref!='T') return NMEA_MALFORMED;
+  if(cdeg<0 || cdeg>36000) return NMEA_MALFORMED;
+
+  out.kind = (ref=='R') ? NMEA_KIND_MWV_R : NMEA_KIND_MWV_T;
+  out.angleCdeg = wrap36000(cdeg);
+  out.angleDeg = wrap360((cdeg+50)/100);
+  parseSpeedField(t, out);
+  return NMEA_OK;
+}
+
+// VWR and VWT: angle 0..180 off the bow plus L/R side
+static NmeaParseResult handleSideAngle(const NmeaTokens& t, WindSample& out, NmeaWindKind kind){
+  if(t.count<3) return NMEA_MALFORMED;
+  int32_t cdeg;
+  if(!nmeaParseFixed(field(t, 1), t.len[1], 2, cdeg)) return NMEA_MALFORMED;
+  if(cdeg<0 || cdeg>18000) return NMEA_MALFORMED;
+  int awa = (cdeg+50)/100;
+  bool left = (fieldChar(t, 2)=='L');
+
+  out.kind = kind;
+  out.angleCdeg = left ? wrap36000(36000-cdeg) : cdeg;
+  out.angleDeg = left ? wrap360(360-awa) : awa;
+  parseSpeedField(t, out);
+  return NMEA_OK;
+}
+
+static NmeaParseResult handleVWR(const NmeaTokens& t, WindSample& out){
+  return handleSideAngle(t, out, NMEA_KIND_VWR);
+}
+static NmeaParseResult handleVWT(const NmeaTokens& t, WindSample& out){
+  return handleSideAngle(t, out, NMEA_KIND_VWT);
+}
+
+/* ========= Formatter dispatch ========= */
+// Add new sentence types here - lookup cost does not grow with the list
+struct FormatterEntry {
+  const char* fmt;
+  SentenceHandler handler;
+};
+
+static const FormatterEntry kFormatters[] = {
+  { "MWV", handleMWV },
+  { "VWR", handleVWR },
+  { "VWT", handleVWT },
+};
+
+#define FMT_TABLE_BITS  4
+#define FMT_TABLE_SIZE  (1u << FMT_TABLE_BITS)
+
+static inline uint32_t fmtKey(const char* p){
+  return ((uint32_t)(uint8_t)p[0] << 16) | ((uint32_t)(uint8_t)p[1] << 8) | (uint8_t)p[2];
+}
+static inline uint32_t fmtSlot(uint32_t key){
+  return (key * 2654435761u) >> (32 - FMT_TABLE_BITS);
+}
+
+// Open-addressed hash table, filled once at static init
+struct FormatterTable {
+  uint32_t key[FMT_TABLE_SIZE];
+  SentenceHandler handler[FMT_TABLE_SIZE];
+
+  FormatterTable(){
+    memset(key, 0, sizeof(key));
+    memset(handler, 0, sizeof(handler));
+    for(const FormatterEntry& e : kFormatters){
+      uint32_t k = fmtKey(e.fmt);
+      uint32_t s = fmtSlot(k);
+      while(handler[s]) s = (s+1) & (FMT_TABLE_SIZE-1);
+      key[s] = k;
+      handler[s] = e.handler;
+    }
+  }
+
+  SentenceHandler find(uint32_t k) const {
+    uint32_t s = fmtSlot(k);
+    while(handler[s]){
+      if(key[s]==k) return handler[s];
+      s = (s+1) & (FMT_TABLE_SIZE-1);
+    }
+    return nullptr;
+  }
+};
+
+static const FormatterTable fmtTable;
+
+static NmeaParseResult dispatch(const char* line, const NmeaTokens& t, WindSample& out){
+  // Formatter is the last 3 chars of the address field:
+  // 2-char talker ($IIMWV, $WIMWV) or a 3-char one (6-char address)
+  uint16_t alen = t.len[0];
+  if(alen!=5 && alen!=6) return NMEA_UNKNOWN_TYPE;
+  SentenceHandler h = fmtTable.find(fmtKey(line + t.start[0] + alen - 3));
+  if(!h) return NMEA_UNKNOWN_TYPE;
+  return h(t, out);
+}
+
+NmeaParseResult nmeaParse(const char* line, size_t len, WindSample& out){
+  NmeaTokens t;
+  if(!tokenize(line, len, t, true)) return NMEA_NOT_NMEA;
+  if(!t.checksumOk) return NMEA_BAD_CHECKSUM;
+  return dispatch(line, t, out);
+}
+
+NmeaParseResult nmeaParseFramed(const char* line, size_t len, WindSample& out){
+  NmeaTokens t;
+  if(!tokenize(line, len, t, false)) return NMEA_NOT_NMEA;
+  return dispatch(line, t, out);
+}
+
+bool parseNMEALine(const char* line, WindSample& out){
+  return nmeaParse(line, strlen(line), out) == NMEA_OK;
+}
@@ -0,0 +1,72 @@
+#pragma once
+// nmea_parser.h - NMEA 0183 wind sentence parsing
+//
+// Pure C/C++ (no Arduino or FreeRTOS headers) so the same code builds for the
+// ESP32 firmware and for the [env:native] host benchmark.
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define NMEA_MAX_FIELDS  24
+
+// Which wind sentence produced a sample
+enum NmeaWindKind : uint8_t {
+  NMEA_KIND_NONE = 0,
+  NMEA_KIND_MWV_R,
+  NMEA_KIND_MWV_T,
+  NMEA_KIND_VWR,
+  NMEA_KIND_VWT,
+  NMEA_KIND_COUNT
+};
+
+// Outcome of parsing one line
+enum NmeaParseResult : uint8_t {
+  NMEA_OK = 0,          // Wind sample produced
+  NMEA_NOT_NMEA,        // No '$' start or too short
+  NMEA_BAD_CHECKSUM,    // '*hh' present but does not match
+  NMEA_UNKNOWN_TYPE,    // Valid sentence, formatter we don't handle (GGA, RMC, ...)
+  NMEA_MALFORMED,       // Known formatter, fields missing or out of range
+  NMEA_RESULT_COUNT
+};
+
+// Result of parsing one wind sentence
+struct WindSample {
+  NmeaWindKind kind;
+  int angleDeg;      // 0..359, starboard positive (rounded)
+  int32_t angleCdeg; // 0..35999 centidegrees, as sent
+  float speedKn;     // Valid only when hasSpeed
+  bool hasSpeed;
+};
+
+// Field offsets recorded in a single pass over the line (nothing is copied)
+struct NmeaTokens {
+  const char* line;
+  uint8_t count;                       // Fields incl. address field 0
+  uint16_t start[NMEA_MAX_FIELDS];     // Offset of first char of field
+  uint16_t len[NMEA_MAX_FIELDS];       // Field length (may be 0)
+  bool hasChecksum;
+  bool checksumOk;
+};
+
+static inline int wrap360(int d){ d%=360; if(d<0) d+=360; return d; }
+static inline int32_t wrap36000(int32_t c){ c%=36000; if(c<0) c+=36000; return c; }
+
+// Display name used for lastSentenceType ("MWV(R)", "VWR", ...)
+const char* nmeaKindName(NmeaWindKind kind);
+
+// Single pass: field offsets + XOR checksum. `len` excludes CR/LF.
+bool nmeaTokenize(const char* line, size_t len, NmeaTokens& t);
+
+// Fixed-point decimal "123.45" -> value * 10^decimals, extra decimals truncated.
+// Returns false for empty or non-numeric fields.
+bool nmeaParseFixed(const char* s, size_t len, uint8_t decimals, int32_t& out);
+
+// Parse one complete line (without CR/LF), checksum included
+NmeaParseResult nmeaParse(const char* line, size_t len, WindSample& out);
+
+// Same for a line handed out by NmeaFramer: start char and checksum are
+// already validated there, so only fields are split. Never BAD_CHECKSUM.
+NmeaParseResult nmeaParseFramed(const char* line, size_t len, WindSample& out);
+
+// Convenience wrapper: true for a valid wind sentence
+bool parseNMEALine(const char* line, WindSample& out);
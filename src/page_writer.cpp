@@ -0,0 +1,69 @@
+#include "page_writer.h"
+#include <esp_heap_caps.h>
+
+PageWriter::PageWriter(PageHeapStats& s) : stats(s) {
+  startFree = minFree = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+}
+
+void PageWriter::print(int v) {
+  char tmp[12];
+  int n = snprintf(tmp, sizeof(tmp), "%d", v);
+  write(tmp, n);
+}
+
+void PageWriter::sampleHeap() {
+  uint32_t f = heap_caps_get_free_size(MALLOC_CAP_8BIT);
+  if (f < minFree) minFree = f;
+}
+
+void PageWriter::end() {
+  sampleHeap();
+  uint32_t peak = startFree > minFree ? startFree - minFree : 0;
+  stats.requests++;
+  stats.lastPeak = peak;
+  if (peak > stats.maxPeak) stats.maxPeak = peak;
+}
+
+ChunkedPageWriter::ChunkedPageWriter(WebServer& s, const char* type, PageHeapStats& stats)
+    : PageWriter(stats), srv(s) {
+  srv.setContentLength(CONTENT_LENGTH_UNKNOWN);
+  srv.send(200, type, "");
+}
+
+void ChunkedPageWriter::write(const char* s, size_t n) {
+  while (n > 0) {
+    size_t k = PAGE_CHUNK - used;
+    if (k > n) k = n;
+    memcpy(buf + used, s, k);
+    used += k;
+    s += k;
+    n -= k;
+    if (used == PAGE_CHUNK) flush();
+  }
+}
+
+void ChunkedPageWriter::flush() {
+  if (used == 0) return;
+  sampleHeap();
+  srv.sendContent(buf, used);
+  used = 0;
+}
+
+void ChunkedPageWriter::end() {
+  flush();
+  PageWriter::end();
+  srv.sendContent("");   // Terminating chunk
+}
+
+BufferedPageWriter::BufferedPageWriter(WebServer& s, const char* t, PageHeapStats& stats)
+    : PageWriter(stats), srv(s), type(t) {}
+
+void BufferedPageWriter::write(const char* s, size_t n) {
+  page.concat(s, n);
+  sampleHeap();
+}
+
+void BufferedPageWriter::end() {
+  PageWriter::end();
+  srv.send(200, type, page);
+}
@@ -0,0 +1,66 @@
+#pragma once
+// page_writer.h - Write an HTML page to the client piece by piece
+//
+// Fixed fragments and small dynamic values go through one PAGE_CHUNK buffer
+// and out with chunked transfer encoding, so a request never holds the whole
+// document on the heap. BufferedPageWriter keeps the old build-one-String
+// behaviour so the two can be compared (?buffered=1).
+
+#include <Arduino.h>
+#include <WebServer.h>
+
+#define PAGE_CHUNK 512
+
+// Heap taken at the worst point of a request, start free - lowest free seen
+struct PageHeapStats {
+  uint32_t requests;
+  uint32_t lastPeak;
+  uint32_t maxPeak;
+};
+
+class PageWriter {
+public:
+  explicit PageWriter(PageHeapStats& stats);
+  virtual ~PageWriter() {}
+  virtual void write(const char* s, size_t n) = 0;
+  void print(const char* s) { write(s, strlen(s)); }   // Flash strings are mapped on ESP32
+  void print(const String& s) { write(s.c_str(), s.length()); }
+  void print(int v);
+  // Send what is left and record the heap peak
+  virtual void end();
+
+protected:
+  void sampleHeap();
+
+private:
+  PageHeapStats& stats;
+  uint32_t startFree;
+  uint32_t minFree;
+};
+
+// Chunked: at most PAGE_CHUNK bytes of the page in RAM at a time
+class ChunkedPageWriter : public PageWriter {
+public:
+  ChunkedPageWriter(WebServer& srv, const char* type, PageHeapStats& stats);
+  void write(const char* s, size_t n) override;
+  void end() override;
+
+private:
+  void flush();
+  WebServer& srv;
+  size_t used = 0;
+  char buf[PAGE_CHUNK];
+};
+
+// Whole page in one String, sent with Content-Length at end()
+class BufferedPageWriter : public PageWriter {
+public:
+  BufferedPageWriter(WebServer& srv, const char* type, PageHeapStats& stats);
+  void write(const char* s, size_t n) override;
+  void end() override;
+
+private:
+  WebServer& srv;
+  const char* type;
+  String page;
+};
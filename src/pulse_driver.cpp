@@ -0,0 +1,46 @@
+#include "pulse_driver.h"
+#include <string.h>
+
+static const char* const TYPE_NAMES[DISPLAY_TYPE_COUNT] = { "", "sumlog", "logicwind" };
+
+DisplayType displayTypeFromName(const char* name){
+  for (int t = 1; t < DISPLAY_TYPE_COUNT; t++) {
+    if (strcmp(name, TYPE_NAMES[t]) == 0) return (DisplayType)t;
+  }
+  return DISPLAY_TYPE_NONE;
+}
+
+const char* displayTypeName(DisplayType type){
+  return type < DISPLAY_TYPE_COUNT ? TYPE_NAMES[type] : "";
+}
+
+static uint32_t freqOff(const PulseDriver&, float){
+  return 0;
+}
+
+// Sumlog and Logic Wind both take speed as K pulses per knot, capped at fmax
+static uint32_t freqLinear(const PulseDriver& drv, float speedKn){
+  if (speedKn < 0.01f) return 0;
+  if (speedKn >= drv.capKn) return drv.fmaxHz * 1000;
+  return (uint32_t)(speedKn * drv.k * 1000.0f + 0.5f);
+}
+
+void pulseDriverResolve(PulseDriver& drv, const char* typeName,
+                        float k, int fmaxHz, int dutyPct, uint8_t dutyBits){
+  drv.type = displayTypeFromName(typeName);
+  if (fmaxHz < 0) fmaxHz = 0;
+  if (dutyPct < 0) dutyPct = 0;
+  if (dutyPct > 100) dutyPct = 100;
+  drv.k = k;
+  drv.fmaxHz = (uint32_t)fmaxHz;
+  drv.capKn = (k > 0.0f) ? (float)fmaxHz / k : 0.0f;
+  drv.dutyCount = (uint32_t)((((1u << dutyBits) - 1) * dutyPct) / 100);
+  drv.dutyPct = (uint8_t)dutyPct;
+
+  switch (drv.type) {
+    case DISPLAY_TYPE_SUMLOG:    drv.freqMilliHz = freqLinear; drv.label = "Sumlog";     break;
+    case DISPLAY_TYPE_LOGICWIND: drv.freqMilliHz = freqLinear; drv.label = "Logic Wind"; break;
+    default:                     drv.freqMilliHz = freqOff;    drv.label = "Off";        break;
+  }
+  if (k <= 0.0f) drv.freqMilliHz = freqOff;
+}
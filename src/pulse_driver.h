@@ -0,0 +1,48 @@
+#pragma once
+// pulse_driver.h - Per-display pulse driver resolved from DisplayConfig.type
+//
+// The type string is matched once when the config loads or changes; the
+// output task then calls the driver's freqMilliHz() without any string compares.
+// Pure C/C++ so the host test can check the frequency math.
+
+#include <stdint.h>
+
+enum DisplayType : uint8_t {
+  DISPLAY_TYPE_NONE = 0,   // Unknown type string - output stays off
+  DISPLAY_TYPE_SUMLOG,
+  DISPLAY_TYPE_LOGICWIND,
+  DISPLAY_TYPE_COUNT
+};
+
+struct PulseDriver;
+typedef uint32_t (*PulseFreqFn)(const PulseDriver& drv, float speedKn);
+
+// Whole-Hz output as the integer LEDC path has always produced it
+static inline uint32_t pulseRoundHz(uint32_t mHz){ return (mHz + 500) / 1000; }
+
+struct PulseDriver {
+  DisplayType type;
+  PulseFreqFn freqMilliHz; // Output frequency for a speed in mHz, 0 = stop
+  const char* label;      // For log lines
+  float k;                // Pulses per knot
+  float capKn;            // Speed where k * speed reaches fmaxHz
+  uint32_t fmaxHz;
+  uint32_t dutyCount;     // LEDC duty at the resolution given to resolve
+  uint8_t dutyPct;        // For engines that pick their own resolution
+};
+
+// Hysteresis: false while wantMHz stays within bandPermille of the running
+// frequency, so small gust noise never reprograms the timer. Starting and
+// stopping always pass; a band of 0 means any change.
+static inline bool pulseOutsideBand(uint32_t activeMHz, uint32_t wantMHz, uint16_t bandPermille){
+  if (activeMHz == 0 || wantMHz == 0) return activeMHz != wantMHz;
+  uint32_t diff = wantMHz > activeMHz ? wantMHz - activeMHz : activeMHz - wantMHz;
+  return (uint64_t)diff * 1000 > (uint64_t)activeMHz * bandPermille;
+}
+
+DisplayType displayTypeFromName(const char* name);
+const char* displayTypeName(DisplayType type);
+
+// Pick the driver for `typeName` and precompute its constants
+void pulseDriverResolve(PulseDriver& drv, const char* typeName,
+                        float k, int fmaxHz, int dutyPct, uint8_t dutyBits);
@@ -0,0 +1,71 @@
+#pragma once
+// seqlock.h - Versioned snapshot of a small struct shared between tasks
+//
+// Writers bump an odd/even sequence around the update and never wait for
+// readers; readers copy the struct and retry if a write overlapped. A reader
+// therefore always gets a consistent (torn-free) copy without taking a lock.
+// Concurrent writers are serialized by a spin flag; keep writes short.
+// A spinning reader or writer backs off after a while so that a
+// lower-priority task preempted mid-update on the same core can finish.
+
+#include <stdint.h>
+#include <string.h>
+#include <atomic>
+
+#ifndef SEQLOCK_BACKOFF
+#ifdef ARDUINO
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#define SEQLOCK_BACKOFF()  vTaskDelay(1)
+#else
+#include <thread>
+#define SEQLOCK_BACKOFF()  std::this_thread::yield()
+#endif
+#endif
+
+#define SEQLOCK_SPINS  64   // Busy retries before backing off
+
+template <typename T>
+class Seqlock {
+public:
+  Seqlock() : data() {}
+
+  // Modify the shared copy in place: fn(T&) runs between the two sequence bumps
+  template <typename F>
+  void update(F fn) {
+    for (uint32_t n = 1; writer.test_and_set(std::memory_order_acquire); n++) {
+      if (n % SEQLOCK_SPINS == 0) SEQLOCK_BACKOFF();
+    }
+    uint32_t s = seq.load(std::memory_order_relaxed);
+    seq.store(s + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    fn(data);
+    seq.store(s + 2, std::memory_order_release);
+    writer.clear(std::memory_order_release);
+  }
+
+  void write(const T& v) {
+    update([&](T& d) { memcpy(&d, &v, sizeof(T)); });
+  }
+
+  // Consistent copy of the latest write
+  T read() const {
+    T out;
+    for (uint32_t n = 1;; n++) {
+      if (n % SEQLOCK_SPINS == 0) SEQLOCK_BACKOFF();
+      uint32_t s1 = seq.load(std::memory_order_acquire);
+      if (s1 & 1) continue;                 // Write in progress
+      memcpy(&out, (const void*)&data, sizeof(T));
+      std::atomic_thread_fence(std::memory_order_acquire);
+      if (seq.load(std::memory_order_relaxed) == s1) return out;
+    }
+  }
+
+  // Even number that changes on every write (for "anything new?" checks)
+  uint32_t version() const { return seq.load(std::memory_order_acquire) & ~1u; }
+
+private:
+  T data;
+  std::atomic<uint32_t> seq{0};
+  std::atomic_flag writer = ATOMIC_FLAG_INIT;
+};
@@ -0,0 +1,51 @@
+#pragma once
+// spsc_ring.h - Lock-free single-producer/single-consumer ring buffer
+//
+// One task pushes, one task pops; no mutex, no blocking. N must be a power
+// of two. When full, push() fails and the item is counted in dropped.
+
+#include <stdint.h>
+#include <stddef.h>
+#include <atomic>
+
+template <typename T, size_t N>
+class SpscRing {
+  static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscRing size must be a power of two");
+
+public:
+  // Producer side
+  bool push(const T& item) {
+    uint32_t h = head.load(std::memory_order_relaxed);
+    uint32_t t = tail.load(std::memory_order_acquire);
+    if (h - t >= N) {
+      dropped.fetch_add(1, std::memory_order_relaxed);
+      return false;
+    }
+    buf[h & (N - 1)] = item;
+    head.store(h + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer side
+  bool pop(T& item) {
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    uint32_t h = head.load(std::memory_order_acquire);
+    if (t == h) return false;
+    item = buf[t & (N - 1)];
+    tail.store(t + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Approximate when called from a third task
+  size_t size() const {
+    return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire);
+  }
+  static constexpr size_t capacity() { return N; }
+
+  std::atomic<uint32_t> dropped{0};
+
+private:
+  std::atomic<uint32_t> head{0};
+  std::atomic<uint32_t> tail{0};
+  T buf[N]{};
+};
@@ -0,0 +1,430 @@
+// Generated by tools/build_web_assets.py from web/ - do not edit
+#include "web_assets.h"
+
+static const uint8_t WEB_APP_CSS_GZ[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x75,0x54,0xcb,0x6e,0xe3,0x30,0x0c,0xbc,0xe7,0x2b,
+  0x04,0x04,0x05,0x5a,0x20,0x0e,0x94,0xac,0xeb,0xba,0xee,0x65,0xf7,0xb8,0xe7,0xc5,0x7e,0x00,0x6d,0x51,
+  0xb6,0x50,0x59,0x0a,0x64,0xe5,0xd5,0x45,0xff,0x7d,0xf5,0xf0,0xb3,0x4d,0x50,0xa0,0x80,0x15,0x72,0xc8,
+  0xe1,0x0c,0x59,0x6a,0x76,0x25,0xff,0x56,0x84,0x70,0xad,0x6c,0xc2,0xa1,0x15,0xf2,0x5a,0x90,0xee,0xda,
+  0x59,0x6c,0x93,0xa3,0xd8,0xfc,0xc1,0x5a,0x23,0xf9,0xfb,0x7b,0xf3,0xcb,0x08,0x90,0x6f,0x2e,0xb0,0x05,
+  0x53,0x0b,0x55,0x10,0xea,0x3f,0x4a,0xa8,0xde,0x6b,0xa3,0x8f,0x8a,0x15,0x64,0x8d,0xc0,0x33,0x5e,0xbe,
+  0xad,0x3e,0x57,0xdb,0x0a,0x0c,0x0b,0xb0,0x2d,0x5c,0x92,0xb3,0x60,0xb6,0x29,0xc8,0x4b,0x4e,0x0f,0x97,
+  0x39,0xc2,0x2e,0x3f,0x5c,0x08,0x1c,0xad,0xf6,0x8f,0x07,0x60,0x4c,0xa8,0xba,0x20,0x79,0x0c,0x9a,0x23,
+  0x2b,0xad,0xd0,0xc3,0x72,0x81,0x92,0x75,0x68,0x03,0xf2,0xa2,0x34,0xe7,0x3c,0x24,0x69,0xc3,0xd0,0x38,
+  0x64,0x07,0xdc,0x69,0x29,0x18,0x59,0x33,0xc6,0xa6,0x5f,0x12,0x03,0x4c,0x1c,0x3b,0x17,0x90,0xf6,0x55,
+  0xf4,0x25,0xe9,0x1a,0x60,0xfa,0xec,0x08,0x91,0xbd,0x4b,0xf3,0x3d,0x99,0xba,0x84,0x47,0xba,0x09,0x7f,
+  0x5b,0x9a,0x3e,0x2d,0xfa,0xdb,0xd1,0x18,0x35,0x31,0x49,0x4a,0x6d,0xad,0x6e,0x23,0x21,0xdf,0xa7,0xc4,
+  0x1a,0x55,0xe4,0x3f,0xa6,0xd1,0x90,0xe8,0x93,0x2a,0x2d,0xb5,0xeb,0x71,0x9d,0xa6,0xe9,0xdb,0x30,0xf8,
+  0x33,0x8a,0xba,0xb1,0x05,0x79,0xa6,0x74,0x7c,0xeb,0xc4,0x07,0x16,0x64,0x4f,0x23,0xe6,0xd6,0xe8,0xf3,
+  0x86,0x6c,0xdf,0x4f,0x01,0x96,0x89,0xee,0x20,0xc1,0x29,0xc5,0x25,0x06,0xd0,0x1a,0x0e,0x05,0xc9,0x62,
+  0x01,0x90,0xa2,0x56,0x89,0x70,0x0a,0x3a,0xa6,0x15,0x2a,0x8b,0x66,0x3e,0x76,0x17,0x15,0xc5,0xf3,0xb9,
+  0xc9,0xd9,0xf8,0x4c,0xff,0xdf,0x57,0x11,0xea,0x70,0xb4,0x9b,0xf2,0xe8,0xf8,0xa8,0x4d,0x87,0x12,0x2b,
+  0xbb,0xa4,0x91,0x4d,0xe4,0x67,0x4d,0xee,0x9e,0x7b,0xe2,0x50,0xa2,0x8c,0xba,0xbb,0xb1,0xf4,0xba,0xef,
+  0x46,0x0a,0x5d,0x0b,0x52,0x4e,0x6e,0xeb,0x73,0xf7,0xcb,0xb1,0x64,0x59,0x16,0x82,0x15,0xdc,0xa1,0x7a,
+  0x5f,0xf8,0x51,0xde,0x3b,0xf2,0xf4,0x95,0xf4,0x09,0x0d,0x97,0x5e,0xf2,0x46,0x30,0x86,0xea,0xb6,0x11,
+  0xd2,0xaf,0x46,0xd8,0x3d,0x8d,0x7d,0x41,0x24,0xe1,0x1a,0x72,0xa8,0x4b,0x77,0xec,0xa7,0x01,0x59,0xbc,
+  0xd8,0x84,0x61,0xa5,0x0d,0x58,0xa1,0xd5,0xe0,0xe3,0xfe,0x87,0xa0,0xd2,0x5c,0x9f,0xc5,0x00,0x26,0x4a,
+  0xd1,0x18,0xdf,0x1d,0xfd,0xdd,0x37,0x43,0x73,0x85,0x84,0xce,0x26,0x55,0x23,0x64,0xf4,0xe0,0x12,0x69,
+  0x58,0xa6,0x18,0xbb,0x85,0xca,0x8a,0x13,0x7e,0xdf,0xa8,0x7d,0x0e,0x2f,0xe9,0xf3,0xac,0xaf,0x73,0xe3,
+  0x1c,0x35,0x2b,0xd2,0xf8,0x31,0x16,0x4a,0xdb,0xc7,0x1e,0xe3,0xe9,0xc6,0x5a,0xe6,0xfc,0x95,0x43,0x58,
+  0x5d,0xad,0x1d,0xcd,0xe8,0x25,0xdd,0x89,0x38,0x0f,0x2e,0x2e,0x18,0xb8,0x48,0xe4,0x76,0xb8,0x28,0xbd,
+  0x58,0xe1,0x63,0x70,0x10,0xa5,0x0f,0xb7,0x6f,0xc2,0xbd,0x59,0xce,0xfd,0xf5,0x63,0xe9,0xaf,0x3c,0xcf,
+  0xbf,0xde,0x9b,0x58,0xec,0x23,0x11,0x8a,0x05,0x45,0xc3,0x2c,0x7f,0xb6,0xc8,0x04,0x90,0xc7,0xd9,0x05,
+  0xcb,0xa8,0x73,0x72,0xa4,0x39,0x5d,0xb8,0xd1,0x66,0x91,0xc4,0x60,0xb2,0xf1,0x79,0x10,0x70,0x7c,0x1f,
+  0x2b,0xf7,0x2f,0x9f,0xbe,0xdf,0xf1,0xb2,0x2d,0x36,0xcd,0x47,0xdc,0x74,0xb1,0xcf,0x99,0x5d,0x84,0xb0,
+  0xfd,0xe9,0x14,0x1c,0x3e,0x1c,0x2b,0x1f,0xd6,0xef,0xe4,0x6c,0x21,0x5f,0x69,0x8f,0x70,0x73,0xdb,0xe7,
+  0xa3,0x0b,0x90,0x63,0x47,0x6e,0xc9,0xc3,0x89,0x09,0xc5,0xa7,0x35,0xf8,0x32,0xcb,0x74,0xe0,0x79,0x43,
+  0x83,0x4f,0x37,0xd7,0xff,0x80,0x12,0x7b,0xdf,0x72,0x06,0x00,0x00
+};
+static const uint8_t WEB_APP_JS_GZ[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x9d,0x57,0x6d,0x6f,0xdb,0x36,0x10,0xfe,0xee,0x5f,
+  0x71,0x50,0x0b,0x48,0x04,0x52,0xd9,0xce,0x9a,0x35,0xad,0xe7,0x16,0x69,0x92,0x21,0x01,0xb2,0x2e,0x48,
+  0xdc,0xf4,0xc3,0x30,0x38,0x8c,0x44,0xdb,0x4c,0x69,0x49,0x13,0x69,0x3b,0x42,0xea,0xff,0xbe,0x23,0xf5,
+  0xfe,0xd2,0xd8,0x5b,0x00,0xc7,0x16,0x75,0xf7,0x1c,0xef,0xe1,0xf1,0x39,0xb2,0xdf,0x87,0x0b,0x3e,0x5f,
+  0x08,0xfc,0x28,0x50,0x0b,0x06,0x8a,0x3e,0x40,0x38,0x33,0x3f,0xbd,0x55,0x1c,0xb3,0x40,0x41,0x44,0xe7,
+  0xac,0xe7,0x87,0xde,0x6a,0x89,0x4f,0xee,0x3f,0x2b,0x16,0x27,0xb7,0x4c,0x30,0x4f,0x85,0xf1,0x89,0x10,
+  0x8e,0xed,0x06,0x74,0x0d,0xd4,0x26,0xee,0x2c,0x8c,0xcf,0xa9,0xb7,0x70,0x28,0x8c,0x3f,0xc2,0x73,0x0f,
+  0x80,0xcf,0xc0,0xa1,0xee,0x9c,0xa9,0x13,0xa5,0x62,0xfe,0xb0,0x52,0xcc,0xb1,0x17,0x31,0x9b,0xd9,0x04,
+  0xc6,0xe3,0x31,0x88,0xd0,0xa3,0x8a,0x87,0x81,0x1b,0x51,0xb5,0x08,0xe8,0x92,0x11,0xa0,0xae,0x27,0xa8,
+  0x94,0x57,0x5c,0x2a,0x97,0xfa,0xbe,0x63,0x53,0x4f,0xf1,0x35,0xb3,0xc9,0xa8,0xb7,0xc5,0x4f,0x4f,0x30,
+  0x9c,0x66,0x12,0xf1,0x60,0x0e,0x63,0x98,0x51,0x21,0xd9,0xa8,0x47,0x65,0x12,0x78,0x30,0x5b,0x05,0x9e,
+  0x06,0x03,0xc4,0x8f,0x99,0x5c,0x38,0x44,0xcf,0x40,0xc5,0x89,0xfe,0x02,0xf0,0xc2,0x40,0x2a,0x88,0xd1,
+  0x8b,0x6e,0x28,0x57,0x30,0x63,0x0a,0x67,0x6a,0xf7,0x69,0xc4,0xfb,0x0a,0xb3,0x59,0x32,0x34,0xc5,0x30,
+  0x99,0xe1,0x63,0x61,0x18,0xbb,0x8f,0x32,0x0c,0x1c,0x0c,0xae,0x61,0xfa,0x7d,0xf8,0x1a,0xf9,0x54,0x21,
+  0x3b,0xe1,0x72,0x89,0xd1,0xa4,0xa2,0x6a,0x25,0xc1,0x20,0x04,0x4a,0xea,0x94,0x91,0xbb,0x04,0xd8,0x13,
+  0xa6,0x50,0x8d,0x4c,0x37,0xe7,0x02,0x41,0x0b,0x1e,0x91,0x95,0xf3,0xd4,0xe9,0x73,0x72,0x89,0x89,0xa2,
+  0x81,0x9d,0x05,0x49,0x3d,0x68,0x30,0x7f,0xd9,0x03,0x0d,0xea,0x1e,0x32,0xf2,0x5f,0xf6,0x40,0x83,0x86,
+  0x07,0xbe,0x62,0x81,0xc7,0x26,0x49,0xc4,0xe4,0x0e,0xdf,0xcc,0x74,0xaa,0xb4,0x6d,0x0e,0x93,0x93,0x72,
+  0xc5,0xe6,0xd4,0x4b,0x0a,0x1a,0xaa,0x21,0x14,0xbd,0x8c,0x76,0x40,0x2b,0x3a,0xe5,0x51,0x23,0xfb,0xe8,
+  0x56,0xf2,0x1d,0xe9,0xd0,0x68,0x2a,0xd1,0xa8,0xe9,0xb8,0x2b,0x1c,0xba,0x35,0xa3,0x29,0x2f,0xba,0xc5,
+  0x85,0x64,0x2f,0x3b,0xa2,0xd5,0x54,0xaf,0x37,0x6b,0x66,0xff,0x85,0x6d,0x30,0xcf,0x78,0xe5,0xa9,0x55,
+  0xcc,0xfc,0x66,0x4d,0xd4,0xc9,0xd0,0x69,0x7d,0xc1,0x5a,0xdf,0x4d,0x89,0xce,0x6d,0xaa,0xb7,0x45,0x63,
+  0xcd,0x10,0xc3,0x04,0xd8,0x03,0xc1,0xd8,0x75,0x11,0xbb,0x7b,0x06,0x19,0xb9,0x1d,0x13,0xa0,0xd1,0x3e,
+  0xf1,0x69,0xd4,0x19,0x3e,0x58,0x32,0x7a,0x1d,0x87,0x2a,0xf4,0x42,0xf1,0x32,0x80,0xb6,0x9c,0x46,0x99,
+  0x69,0x07,0x48,0x18,0xab,0x7d,0x00,0xd0,0xac,0xed,0x7c,0x11,0xca,0x7d,0x9c,0x17,0x68,0xd6,0x76,0xde,
+  0x27,0x7b,0xe3,0x5e,0xcf,0xdf,0xfc,0xd3,0x8a,0x68,0xa4,0x80,0xa4,0x8a,0xe0,0x2a,0xf6,0xa4,0x4e,0x43,
+  0xbd,0xb5,0x14,0xe2,0x3d,0xba,0x38,0x0a,0x3f,0x7e,0x80,0xf5,0xc6,0x1a,0x15,0x0e,0x46,0x09,0x48,0x2a,
+  0x08,0x2d,0x07,0x1c,0x15,0xac,0xb4,0x35,0x1a,0x40,0x52,0x29,0x68,0xd9,0xca,0x88,0x31,0x7f,0xfa,0x3d,
+  0x70,0x55,0xf8,0x3b,0x7f,0x62,0xbe,0x73,0xd8,0x28,0xe4,0xcf,0x2b,0x2e,0xfc,0x42,0x15,0xc0,0x6c,0x75,
+  0x10,0xb9,0x92,0x19,0xfc,0xba,0x62,0x10,0x48,0xe5,0x15,0x20,0x53,0x66,0xb4,0x1f,0xc3,0x5f,0x7f,0x8f,
+  0xb2,0x51,0xed,0xf2,0xe8,0x2e,0xa8,0x9c,0x2e,0x37,0xeb,0x69,0x4c,0x52,0x13,0x37,0x5a,0xa1,0x40,0x5b,
+  0x7f,0x7c,0xbb,0x73,0x6e,0x88,0x45,0xba,0x8d,0x55,0xdb,0x78,0xd2,0x69,0xbc,0xde,0x34,0x70,0xef,0xbe,
+  0xdd,0x74,0xdb,0xa9,0xa6,0xdd,0xa4,0xb4,0x6b,0x24,0xd6,0xe0,0x2e,0x75,0x13,0x2c,0x98,0xab,0x05,0x7c,
+  0x84,0x01,0x7c,0xca,0x86,0x1e,0x43,0x1e,0x38,0xd6,0x01,0x58,0x04,0x3e,0x80,0xa5,0x3b,0x06,0xf6,0x26,
+  0xd7,0x75,0xb3,0xe5,0xdb,0x76,0xa9,0x64,0xa6,0x0f,0x0e,0xf6,0x4b,0xdd,0x46,0xb0,0xfb,0xf1,0x07,0x2e,
+  0xb8,0x4a,0x48,0x49,0x73,0xaa,0x9a,0x24,0x97,0xcf,0xf6,0x52,0x1a,0xcd,0x6c,0x97,0x4a,0x26,0x9b,0xa4,
+  0x10,0xd0,0x76,0xc1,0xa4,0x1b,0xbb,0xc3,0x35,0x8d,0x98,0x7e,0x77,0xb9,0x75,0xc4,0x2b,0x85,0x93,0x54,
+  0x44,0xb4,0xe5,0xac,0x95,0x13,0x37,0x50,0x80,0x87,0x06,0xd4,0xc7,0x4f,0x60,0x15,0x0f,0x96,0xa6,0xcd,
+  0xe7,0xb2,0x1c,0xd8,0x43,0x5a,0xab,0x34,0x95,0x6a,0x46,0xea,0xf2,0xda,0x49,0x59,0x91,0x79,0x10,0x2a,
+  0xbd,0xa5,0x67,0x7c,0xae,0x71,0x2b,0x19,0x55,0xe4,0xb5,0x2c,0xee,0x74,0xf3,0x97,0x19,0xe4,0x70,0xc5,
+  0xc8,0xa8,0x66,0x88,0x44,0x95,0x6b,0x54,0x14,0x58,0x09,0xdc,0x98,0x5a,0x95,0x99,0xfb,0xd3,0xe2,0xc1,
+  0x79,0xfd,0xcc,0xa3,0x2d,0xb9,0xd7,0x0c,0x9d,0xb5,0x19,0xaa,0x23,0x4a,0x95,0x08,0xe6,0xa2,0x52,0x86,
+  0x71,0x03,0xd1,0x7a,0x75,0x78,0x4c,0xdf,0xbd,0x3d,0x32,0x4c,0xbf,0xf2,0xbd,0x5f,0x8e,0xf0,0x77,0xab,
+  0x3a,0xcb,0xe2,0xc9,0xc9,0xac,0x3e,0xbd,0x58,0x44,0x77,0x67,0x7f,0xbe,0x39,0xa5,0xa2,0x5e,0x85,0x3f,
+  0xa3,0x50,0x70,0x73,0x4c,0xca,0x30,0xf2,0x47,0x84,0x19,0x8c,0x3a,0x0c,0x27,0x18,0x56,0xa7,0x93,0x7b,
+  0xe1,0xa1,0x51,0x6f,0x3d,0x5c,0xbd,0x7c,0x4c,0x67,0x75,0xff,0xfa,0x39,0x7b,0xda,0x66,0xc3,0xc5,0x00,
+  0xee,0xd5,0x21,0x3a,0xd8,0xd2,0x46,0x3b,0xdb,0xde,0xde,0xe7,0x51,0xca,0x29,0x36,0x72,0xbb,0x3f,0x31,
+  0x27,0x4e,0xcd,0x7e,0x39,0x07,0x5c,0x85,0x0e,0xc7,0x3a,0xe7,0x05,0xcf,0x9d,0xdc,0xd6,0xfb,0x5e,0x49,
+  0x4b,0x2a,0x4f,0xa6,0xcd,0x99,0xf4,0xac,0xc9,0xe9,0xb5,0x55,0xbe,0x86,0x46,0xc3,0x6c,0x4c,0x56,0x5b,
+  0x83,0x93,0xce,0x93,0x14,0x75,0xb1,0xc5,0xa3,0x87,0x64,0x6d,0xe8,0x8b,0xc9,0xe4,0xbf,0x60,0x6b,0xf3,
+  0x9f,0x82,0xef,0x0b,0xf2,0xf5,0x0c,0x31,0x74,0x07,0x61,0x01,0x0a,0x63,0x05,0xa6,0x42,0x52,0xc1,0x8f,
+  0x69,0xe9,0xa4,0xd2,0xde,0x5b,0x75,0xa7,0xdb,0xb9,0x29,0xba,0xe1,0x60,0x38,0x1c,0x54,0x4a,0xae,0xec,
+  0xea,0xa4,0xd2,0xe1,0x5b,0xfe,0xba,0xa3,0xa7,0xfe,0xef,0x0f,0xdd,0xe1,0xaf,0xc7,0xee,0x5b,0xf7,0xb0,
+  0x81,0xd2,0x2e,0xdd,0x9d,0x6b,0xd4,0x25,0x0f,0x35,0xc9,0x1b,0xd5,0xd8,0xda,0x43,0x06,0xac,0xd3,0x9a,
+  0x40,0x76,0x6e,0xff,0x06,0xd8,0xff,0x52,0x80,0x8e,0xf5,0xd4,0x57,0x9c,0xb3,0xeb,0x0f,0x70,0xba,0x60,
+  0xde,0x77,0x9d,0x3b,0x5e,0x77,0x28,0x70,0x09,0x78,0x15,0x5b,0x51,0x21,0x12,0xdd,0xb3,0xf4,0x05,0x8c,
+  0x07,0xe0,0x6c,0xb8,0x5a,0xe0,0x37,0xde,0xd9,0x14,0x1c,0x61,0x0f,0xc5,0xb0,0xbe,0x24,0x0d,0x62,0x34,
+  0xc0,0xc9,0x9c,0x19,0x5a,0xcc,0xc1,0x48,0x0f,0x4c,0xf1,0x56,0xa9,0x57,0xe2,0xbd,0xf9,0x1b,0x75,0xb9,
+  0xa4,0x1b,0x71,0x5c,0xf8,0xff,0x06,0x47,0x83,0xc1,0x60,0x2f,0x2e,0x2b,0xfe,0x98,0x7f,0xbe,0xa5,0x4d,
+  0x26,0x33,0x11,0x6e,0x4c,0x29,0x6a,0x36,0x6e,0x18,0xf5,0x13,0xd0,0x8d,0x58,0xbf,0xdb,0x8f,0xda,0x3a,
+  0x76,0x8d,0xdb,0xd9,0xcc,0x1b,0x0e,0xde,0x75,0x14,0xf9,0x16,0x6f,0xba,0x78,0xdf,0x64,0xe4,0x79,0xdb,
+  0xdb,0xf6,0x7a,0x38,0x01,0x3f,0xdc,0xe8,0x1b,0xee,0xf9,0x1a,0x27,0x7c,0x65,0xf6,0x07,0x8b,0x1d,0x5b,
+  0x84,0xd4,0xb7,0x0f,0xc0,0x21,0xf9,0x15,0xba,0xb8,0xcd,0x8e,0xb4,0x96,0x48,0xa6,0x2e,0x31,0xc5,0x78,
+  0x4d,0x85,0x93,0xbd,0x39,0x80,0xe3,0xc1,0x20,0xbb,0x1e,0xff,0x0b,0x02,0x54,0x23,0x1a,0xce,0x0f,0x00,
+  0x00
+};
+static const uint8_t WEB_DISPLAY_CSS_GZ[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0x9d,0x54,0x5f,0x6f,0xdb,0x20,0x10,0x7f,0xef,0xa7,
+  0x40,0x9a,0xa6,0x26,0xd2,0x88,0x48,0xdd,0x66,0x1d,0xfb,0x22,0x7b,0xc5,0x06,0xec,0x53,0x09,0x67,0x01,
+  0xa9,0xb3,0x4e,0xfb,0xee,0x3b,0xb0,0x9d,0xd9,0x69,0x26,0x55,0x93,0x5f,0xcc,0x71,0xfc,0xfe,0x1d,0xf6,
+  0x0e,0xbc,0x45,0x0e,0x0d,0x7a,0xf6,0xeb,0x8e,0x31,0x0d,0xb1,0x77,0xea,0xa7,0x64,0xe0,0x1d,0x78,0xc3,
+  0x6b,0x87,0xcd,0xcb,0x77,0xda,0x18,0x40,0xa7,0x4e,0xb2,0xfd,0xa1,0x3f,0xe7,0x65,0x67,0xa0,0xed,0xd2,
+  0xdf,0x75,0xad,0x9a,0x97,0x36,0xe0,0xc9,0x6b,0xc9,0x3e,0x09,0xf1,0xb5,0xb6,0x36,0x97,0x1b,0x74,0x18,
+  0x24,0x1b,0x3a,0x48,0xa6,0xb4,0x61,0xd0,0x26,0xf0,0xa0,0x34,0x9c,0xa2,0x64,0x4f,0xe2,0x73,0xae,0x26,
+  0x73,0x4e,0x5c,0x39,0x68,0xbd,0x64,0x8d,0xf1,0xc9,0x84,0x5c,0x2d,0xfc,0xd7,0x3c,0x16,0x7d,0xe2,0x11,
+  0xde,0x0c,0x95,0x1e,0x16,0xa5,0x61,0xea,0xab,0xd1,0xe9,0x42,0x7c,0x0a,0x31,0x33,0x77,0xc6,0xf5,0x79,
+  0x7d,0x54,0xa1,0x05,0xcf,0x9d,0xb1,0xd4,0xf4,0x3c,0x1e,0xec,0x31,0x42,0x02,0x24,0xd2,0x60,0x9c,0x4a,
+  0xf0,0x5a,0x24,0xbe,0x9a,0x90,0xa0,0x51,0x6e,0x16,0x74,0x04,0xad,0x1d,0xed,0xfc,0xbe,0xdb,0x5d,0xa2,
+  0x92,0x1d,0x52,0x9b,0x94,0xca,0x92,0xd6,0x92,0x1b,0x15,0x13,0x29,0x97,0x4c,0xa5,0x14,0x36,0x5a,0x25,
+  0xc5,0x13,0xa2,0x4b,0xd0,0x6f,0xd7,0x54,0xaa,0x8e,0xe8,0x4e,0x73,0x1a,0x29,0xe1,0x51,0xb2,0x87,0xa7,
+  0x51,0xd0,0xa8,0x6e,0x0e,0x25,0x28,0x1f,0x2d,0x06,0xda,0x2f,0xaf,0xa4,0xd0,0xfc,0xd8,0x70,0xda,0xdd,
+  0xbe,0x0b,0xbc,0xaa,0xaa,0x5b,0x69,0xf7,0x4a,0x6b,0xf0,0x6d,0x31,0x7c,0x89,0xeb,0x6a,0x04,0x8f,0xff,
+  0xcc,0xb5,0xc0,0xf0,0xd8,0xab,0x86,0x8a,0x1e,0x87,0xa0,0x4a,0x92,0x6f,0x1c,0xbc,0x36,0x67,0xea,0x13,
+  0x42,0x8c,0x80,0x67,0x1e,0x3b,0xa5,0x71,0x90,0x4c,0x30,0x3a,0x5c,0xe8,0x42,0x5b,0xab,0x8d,0xf8,0x52,
+  0x9e,0x5d,0xb5,0xbd,0x9d,0x5f,0x6d,0xc8,0xa0,0x59,0x07,0x78,0x7f,0xff,0x81,0xc0,0xc4,0x7f,0x04,0x56,
+  0x7c,0x53,0x37,0x89,0x23,0x44,0xd0,0x63,0x57,0xaf,0x02,0xd1,0x2e,0x82,0x49,0xd8,0xf3,0x29,0xc8,0x39,
+  0xd7,0xa5,0xe5,0x7d,0x71,0x12,0x4d,0x93,0xd5,0xd1,0xf5,0x54,0x7a,0xba,0x01,0xab,0x81,0xd8,0x67,0xfb,
+  0xcd,0xaa,0xd5,0x0c,0xf6,0x22,0x0f,0x61,0x9a,0xf4,0x78,0x1d,0x65,0x59,0x53,0x68,0xf4,0x2c,0x14,0x8c,
+  0xae,0x1e,0x2f,0x3a,0x17,0xdf,0xd3,0xd5,0xf0,0x2a,0xea,0xa9,0x46,0x84,0x5b,0xb2,0xba,0xaa,0x28,0x9b,
+  0xc9,0xc4,0xe2,0x8e,0x2c,0x30,0x97,0xa3,0x2f,0x5f,0xd9,0x7b,0xa0,0x7e,0x85,0xb3,0xd2,0xbc,0x3c,0x5d,
+  0x8d,0xe6,0x66,0x8a,0xc3,0xe1,0xb0,0x02,0xb3,0x60,0x9c,0x8e,0x26,0x2d,0xc0,0x72,0xda,0x72,0x65,0xbe,
+  0x14,0x3c,0xfa,0x5b,0xbf,0x8b,0x4c,0x3a,0x59,0xce,0xc0,0x7f,0x00,0x9a,0x2a,0xa2,0xa6,0xbb,0x04,0x00,
+  0x00
+};
+static const uint8_t WEB_DISPLAY_JS_GZ[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xcd,0x57,0x5b,0x6f,0xe2,0x38,0x14,0x7e,0xef,0xaf,
+  0x38,0x9a,0x87,0x26,0x99,0x69,0x03,0x54,0x9a,0x7d,0xc8,0x88,0xad,0x98,0xc2,0x48,0xd5,0xd2,0x0e,0x6a,
+  0xca,0x54,0xfb,0x84,0x3c,0x89,0x81,0x74,0x43,0x9c,0x75,0x1c,0xd2,0xa8,0xc3,0x7f,0xdf,0x63,0x3b,0x37,
+  0xee,0xb0,0xda,0x87,0x95,0x00,0x39,0xf1,0x39,0x9f,0xcf,0xfd,0x33,0x17,0xd3,0x34,0xf2,0x44,0xc0,0x22,
+  0x48,0x63,0x9f,0x08,0xda,0x0f,0x92,0x38,0x24,0xf9,0xb7,0x80,0x86,0x7e,0x62,0x5a,0xf0,0x7e,0x01,0xe0,
+  0xb1,0x28,0x11,0x40,0x23,0xf2,0x33,0xa4,0x3e,0x74,0xc1,0x67,0x5e,0xba,0xa0,0x91,0xb0,0x67,0x54,0x0c,
+  0x42,0x2a,0x97,0x5f,0xf3,0x7b,0xdf,0x34,0x7c,0xad,0x3c,0xd0,0x92,0x86,0x65,0x7b,0x73,0xea,0xfd,0x45,
+  0xfd,0x2f,0x15,0x88,0xc8,0x63,0x7a,0x02,0xc2,0x33,0x8a,0xa1,0xfa,0x92,0x84,0x29,0x95,0xca,0xf8,0x69,
+  0xb5,0xe0,0x2b,0x49,0x02,0x4f,0x02,0x4d,0x83,0x19,0x70,0x96,0x25,0x60,0x3e,0x50,0x41,0x39,0x48,0xf1,
+  0x2b,0x78,0x7c,0x18,0xf4,0xc0,0x45,0x28,0x1a,0x79,0xd4,0x72,0x20,0x99,0xb3,0x0c,0x58,0x14,0xe6,0x90,
+  0xcd,0x69,0x54,0xda,0x5f,0x99,0xa2,0x71,0x9e,0x24,0x4c,0xc3,0xa0,0xbf,0x53,0xca,0x73,0x97,0x86,0xd4,
+  0x13,0x8c,0xf7,0xc2,0xd0,0x34,0xec,0xc2,0xa6,0x89,0x56,0x98,0xe0,0xc1,0x86,0x55,0x78,0x54,0x00,0xd8,
+  0x53,0xc6,0x07,0xc4,0x9b,0x9b,0xb8,0x07,0xdd,0xdf,0x55,0xd0,0x40,0x5a,0x68,0x27,0x22,0x0f,0x69,0x89,
+  0x80,0xe7,0x94,0x41,0xbc,0x05,0xc3,0x00,0x07,0x8c,0x88,0x45,0xd4,0x90,0x60,0x2b,0xab,0xf6,0xb3,0x63,
+  0xc3,0xcb,0xfd,0x63,0x1f,0xfa,0xf7,0x4f,0x83,0xbb,0xe7,0xfb,0xef,0x8f,0x0e,0xb8,0x95,0x2f,0x78,0x14,
+  0x0c,0xd9,0x0c,0x03,0xf1,0x12,0x44,0xbe,0x0e,0xe8,0x4e,0xff,0xa4,0xfb,0xfd,0x80,0x53,0x9d,0xdd,0x2e,
+  0x98,0xe5,0xd9,0x97,0x97,0x45,0x1a,0xba,0x5d,0x30,0x42,0x09,0x95,0x21,0x92,0xf6,0x69,0x6f,0x62,0xa4,
+  0xc8,0xc4,0x2f,0xe1,0x26,0x73,0x4a,0x7c,0xca,0x31,0x45,0x9b,0x0e,0xae,0x9f,0xba,0xe5,0xe6,0x5e,0xfc,
+  0xca,0x8e,0xc6,0x21,0x53,0x55,0x84,0xe7,0x1f,0xa2,0xa3,0x78,0x63,0xc3,0x68,0x3c,0x74,0x07,0x45,0xf0,
+  0x48,0x98,0x91,0x3c,0xd9,0x1f,0xaa,0x51,0x1a,0x26,0xb4,0xce,0xd0,0x41,0x63,0x63,0x29,0x7b,0xd8,0x3c,
+  0x0d,0xb7,0x61,0xda,0xea,0xe2,0x82,0x24,0x79,0xe4,0x41,0xd5,0x74,0x09,0x15,0xfd,0xb5,0xa6,0x31,0xad,
+  0x77,0xf8,0xaf,0x5a,0x8e,0x64,0x24,0x10,0x30,0xa5,0x02,0x2b,0xd3,0x68,0x91,0x38,0x68,0x15,0xd2,0xb7,
+  0x51,0xba,0xe8,0x1a,0xf0,0x09,0x2b,0xcc,0x1d,0x0d,0x7b,0x7f,0x4e,0x1e,0xc7,0x0f,0xf8,0x64,0x5c,0x12,
+  0x65,0x55,0xb7,0x38,0xf7,0x12,0xfb,0x4f,0x89,0x95,0xa5,0x73,0xdb,0x71,0xda,0x96,0xaa,0x93,0x9d,0xc3,
+  0x42,0x6e,0xa0,0x43,0xcf,0xc1,0x82,0xb2,0x54,0x98,0x9c,0x4e,0x39,0x4d,0xe6,0x57,0x9d,0xcf,0x6d,0x6b,
+  0xa7,0xef,0x64,0x59,0x22,0xb8,0x54,0x88,0x20,0x9a,0x21,0xc6,0xff,0x63,0xde,0x14,0x65,0x51,0xcc,0x92,
+  0x13,0x00,0xca,0xb1,0xb3,0x0d,0xc2,0xa6,0x53,0x99,0x64,0x3a,0x3b,0x84,0x52,0x09,0x6d,0xeb,0xcf,0x98,
+  0x60,0xbd,0x68,0x16,0x1e,0xb4,0xa2,0x12,0xda,0xe1,0x44,0xba,0xc0,0xde,0xfa,0xe3,0x90,0x76,0x21,0xb2,
+  0x4f,0xf7,0xdb,0x82,0xbc,0x1d,0x57,0x97,0x52,0xdb,0x08,0xaa,0x53,0xfa,0xa9,0xc8,0x0f,0x01,0x54,0x42,
+  0x7b,0xf4,0x47,0x41,0x74,0x54,0x1d,0x65,0xb6,0xb5,0x7d,0xe2,0xf5,0x7c,0x9f,0x1f,0xcc,0x9f,0x16,0xd9,
+  0x26,0x1b,0x17,0xab,0x13,0x87,0x46,0x28,0x2b,0x5a,0xd5,0x26,0xa0,0x15,0xd8,0xc6,0xc0,0x29,0x72,0x44,
+  0x22,0x6a,0x13,0x09,0x27,0x0b,0xc9,0x21,0x11,0xcd,0x60,0xfc,0x34,0x74,0x29,0xe1,0xde,0x7c,0xa4,0xde,
+  0x9a,0x9a,0x09,0x8a,0x52,0x76,0xa0,0xd1,0x47,0x57,0x6a,0x47,0xd6,0xa7,0xa3,0x7e,0xf5,0x73,0x59,0x72,
+  0x4e,0xb5,0xd2,0xef,0xab,0x02,0x71,0xea,0xa5,0xde,0xa9,0x52,0xef,0xd4,0xcb,0x02,0x4b,0xa7,0xd5,0x29,
+  0x17,0xcd,0xb7,0x32,0x5b,0x4e,0x63,0xad,0xf7,0xaa,0x44,0x38,0xf5,0xb2,0xb1,0x83,0x31,0x76,0xaa,0x95,
+  0x7e,0x5f,0x84,0xcf,0x29,0x17,0x4d,0x26,0xfb,0xd7,0xe3,0x47,0x0e,0x06,0xe3,0xaa,0x60,0xd1,0x05,0x15,
+  0x73,0x86,0xa1,0x33,0x46,0xdf,0xdd,0x67,0x43,0x9f,0xaa,0xd9,0x27,0x71,0xe0,0xdd,0xb8,0x63,0x32,0x4c,
+  0xe2,0x5a,0x75,0x30,0x4a,0x91,0x38,0x0e,0x03,0x8f,0x48,0x9c,0xd6,0xdb,0x75,0x96,0x65,0xd7,0x48,0x98,
+  0x8b,0xeb,0x94,0x87,0x18,0x4c,0xe6,0xe3,0x94,0x58,0x69,0x8c,0x9f,0xcc,0x97,0x6e,0xaa,0x34,0x35,0xad,
+  0x3e,0x63,0x80,0xcd,0x74,0xb4,0xd7,0x46,0xf6,0xf2,0xec,0x36,0x5d,0x0f,0x93,0x14,0xb9,0xf5,0xe9,0xac,
+  0x6b,0x7c,0xd2,0x06,0x8f,0x9f,0xee,0xef,0xd8,0x22,0xc6,0xca,0x8b,0x84,0xb9,0xc4,0xe9,0x7b,0xc8,0x48,
+  0x90,0x56,0x62,0xf1,0x0e,0x19,0xf1,0xc1,0x4b,0x39,0x47,0x25,0x28,0x89,0x49,0x9d,0x98,0x6c,0x3a,0x11,
+  0xa2,0x68,0x31,0x85,0x7f,0x28,0x81,0xe2,0xd2,0x27,0x78,0x5e,0x64,0x40,0x3b,0x26,0xbb,0xe8,0xac,0x8c,
+  0x6a,0x4b,0x4b,0xf5,0xd7,0x4a,0x9d,0xdb,0xaf,0x09,0x8b,0x34,0x5b,0x80,0x16,0x39,0x7b,0xc0,0x23,0xd8,
+  0xab,0x5d,0x12,0xc4,0xaf,0x5f,0x30,0x25,0x58,0x94,0x5f,0x4e,0xc2,0x6a,0x8e,0x7a,0x05,0xa3,0x28,0x02,
+  0x31,0x3e,0xe8,0x6e,0xf8,0x70,0x1a,0xcc,0xe6,0xc0,0x57,0x50,0x15,0x61,0x48,0xb8,0x87,0x97,0x1f,0xc7,
+  0xb0,0xb6,0xc6,0xbe,0x42,0xa9,0x19,0x03,0x61,0xda,0x47,0x20,0xb6,0x4a,0x4a,0x41,0xd4,0xa4,0x71,0x02,
+  0xc4,0xc6,0xf8,0xd7,0x9e,0x14,0xac,0x81,0xea,0x1d,0xfb,0x34,0x80,0x26,0x01,0x34,0x30,0x14,0x7b,0x48,
+  0x98,0xcf,0xc7,0x60,0xb6,0x68,0x40,0xa1,0xd4,0x0c,0x22,0x41,0x4e,0xc2,0x68,0x70,0x41,0x0d,0x21,0x49,
+  0x04,0x11,0xcc,0xce,0xcd,0xc6,0xe0,0xf9,0x08,0x37,0xd6,0xb1,0x9c,0xaf,0x93,0x84,0x02,0x2d,0xb9,0x05,
+  0xaf,0x78,0xed,0x37,0x59,0xfa,0xd5,0x2b,0x5b,0x30,0x57,0x70,0xa4,0x0c,0xb3,0xf3,0x9b,0x85,0x0f,0xe3,
+  0x38,0xa6,0xfc,0x8e,0x24,0x38,0x28,0xe4,0x5d,0xb0,0x6d,0x34,0x2a,0x7f,0xef,0x3d,0x6a,0x05,0x38,0xc4,
+  0xb0,0xcd,0x28,0x76,0xe3,0x4a,0x76,0xb5,0xbc,0x1b,0xe3,0x1f,0x0a,0xe2,0xfb,0x83,0x25,0x1a,0x36,0x0c,
+  0x12,0x2c,0x35,0xca,0xe5,0xcd,0x99,0xf8,0x38,0x2d,0x11,0xbc,0xf8,0xe7,0xb1,0xa3,0xa3,0x71,0x7a,0xe1,
+  0xf7,0x1f,0xa4,0x57,0xc3,0x4a,0xec,0x0d,0x00,0x00
+};
+static const uint8_t WEB_STATUS_HTML_GZ[] PROGMEM = {
+  0x1f,0x8b,0x08,0x00,0x00,0x00,0x00,0x00,0x02,0x03,0xed,0x5c,0xdb,0x92,0x1b,0xb7,0x11,0x7d,0xdf,0xaf,
+  0x80,0xe9,0x44,0x24,0x2b,0xcb,0x1b,0xc8,0x5d,0xad,0xb8,0x24,0x53,0xeb,0x95,0x5c,0x56,0x4a,0x17,0x96,
+  0xb5,0x8a,0x2b,0xa5,0x52,0x29,0xe0,0x0c,0x48,0x8e,0x34,0x1c,0x4c,0x06,0xc3,0xe5,0xd2,0xf2,0x7e,0x45,
+  0x1e,0xf2,0xe2,0x47,0xbf,0xe4,0x2d,0xdf,0x60,0xff,0x89,0xbf,0x24,0xdd,0x00,0xe6,0xc6,0x19,0x5e,0xf6,
+  0x2a,0xa9,0xca,0x96,0x6d,0x0d,0x71,0x69,0x74,0xa3,0xbb,0x4f,0x03,0x8d,0x19,0xf4,0xbe,0xb2,0x85,0x15,
+  0x2e,0x7d,0x4e,0xa6,0xe1,0xcc,0x1d,0xf4,0xcc,0xff,0x39,0xb3,0x07,0x7b,0xbd,0x19,0x0f,0x19,0xb1,0xa6,
+  0x2c,0x90,0x3c,0xec,0x97,0x5e,0x9f,0x7d,0x5b,0x3b,0x2a,0x45,0xc5,0x1e,0x9b,0xf1,0xfe,0xb9,0xc3,0x17,
+  0xbe,0x08,0x42,0x62,0x09,0x2f,0xe4,0x1e,0x34,0x5a,0x38,0x76,0x38,0xed,0xdb,0xfc,0xdc,0xb1,0x78,0x4d,
+  0xfd,0xd8,0x77,0x3c,0x27,0x74,0x98,0x5b,0x93,0x16,0x73,0x79,0xbf,0x85,0x14,0x42,0x27,0x74,0xf9,0xe0,
+  0xef,0x8f,0x5f,0x92,0x67,0x62,0xe2,0x58,0xe4,0x07,0xc7,0xb3,0x09,0xb3,0x99,0x1f,0xf2,0xa0,0xd7,0xd0,
+  0xb5,0x7b,0x3d,0xd7,0xf1,0x3e,0x90,0x80,0xbb,0x7d,0x19,0x2e,0x5d,0x2e,0xa7,0x9c,0x87,0x64,0x1a,0xf0,
+  0x71,0xbf,0xd4,0x60,0x8d,0x43,0xd6,0xe9,0x1c,0xd9,0x94,0x37,0x98,0xef,0xd7,0x2d,0x29,0x91,0x6c,0x43,
+  0xf1,0xdd,0x1b,0x09,0x7b,0x09,0xbf,0x6c,0xe7,0x9c,0x58,0x2e,0x93,0xb2,0x5f,0xb2,0x58,0x60,0x43,0x83,
+  0xbd,0xde,0xb4,0x45,0x14,0xb1,0x7e,0x29,0xe4,0x17,0x61,0x8d,0xb9,0xce,0xc4,0xeb,0x5a,0xc0,0x39,0x0f,
+  0x8e,0xc9,0x8c,0x05,0x13,0xc7,0xab,0x8d,0x44,0x18,0x8a,0x59,0x97,0xfa,0x17,0xc7,0x25,0xc5,0xa3,0xe2,
+  0xee,0x24,0xe2,0x6e,0xda,0x32,0xb4,0xb7,0x12,0x0a,0x85,0xdf,0xad,0x1d,0x01,0x99,0x15,0xca,0x2d,0x4d,
+  0xba,0x27,0x7d,0xe6,0x45,0x1c,0xca,0x19,0x73,0xdd,0xd2,0xe0,0x9b,0xc0,0xf1,0x26,0x64,0x29,0xe6,0x01,
+  0x61,0x1e,0x73,0xc5,0x84,0x48,0xee,0x49,0x11,0x10,0xc7,0x0b,0x05,0x09,0xa7,0x9c,0xd8,0xce,0xc4,0x09,
+  0x99,0x4b,0xd8,0x84,0xf7,0x1a,0x48,0x61,0xd0,0x6b,0x00,0x37,0x28,0x9c,0xc7,0x62,0x81,0xe1,0x11,0xe4,
+  0x25,0xa4,0xc7,0xa2,0x19,0x2b,0x0d,0x5e,0x85,0x2c,0x9c,0xcb,0x5e,0x83,0x65,0x2b,0x6c,0x47,0xfa,0x2e,
+  0x5b,0x82,0x5e,0x1e,0xeb,0x27,0xd2,0x5a,0xd7,0x86,0x26,0x6d,0xe8,0xba,0x36,0xed,0xa4,0x4d,0x5b,0xb5,
+  0xe9,0x35,0x80,0x19,0xf8,0x4b,0x4d,0xd7,0x60,0xaf,0xce,0x6d,0x27,0xac,0x8d,0x42,0x8f,0x7c,0x84,0xee,
+  0x23,0x66,0x7d,0x98,0x04,0x62,0xee,0xd9,0x5d,0xf2,0x75,0xb3,0xf9,0x70,0x34,0x1e,0x1f,0x43,0xb1,0x25,
+  0x5c,0x11,0x74,0xc9,0x62,0xea,0x84,0x1c,0x7f,0x8f,0x44,0x60,0x73,0x28,0xf0,0x84,0xa7,0x7e,0xfb,0xcc,
+  0xb6,0x61,0xa2,0xba,0xa4,0xe3,0x5f,0x90,0x56,0x13,0xa6,0x33,0x6e,0x54,0x0b,0x98,0xed,0xcc,0x65,0x97,
+  0xb4,0x75,0xa9,0x35,0x0f,0x24,0xd2,0xf2,0x85,0xa3,0x94,0x03,0x45,0x63,0x30,0xd6,0x9a,0x74,0x7e,0xe4,
+  0x5d,0xa2,0x54,0x01,0x45,0x46,0x41,0x2e,0x1f,0x87,0x5d,0x82,0x2a,0xdb,0xbb,0x4c,0x38,0xed,0x4e,0xc5,
+  0x39,0x0f,0x8a,0xf8,0x3d,0x38,0x1c,0xb5,0x55,0xd3,0x99,0xb0,0x41,0x27,0xd8,0xc2,0x4c,0x43,0x8a,0x57,
+  0x21,0xc1,0xfe,0x85,0xd7,0x25,0x63,0xe7,0x82,0xdb,0x58,0xf4,0x63,0x0d,0x2c,0x8a,0x5f,0xc0,0xf0,0xcd,
+  0x66,0x13,0x0b,0xf4,0xb8,0xea,0x11,0x8d,0x46,0x3f,0x29,0xef,0x51,0x6d,0xfe,0x8c,0x3f,0xa7,0xdc,0x99,
+  0x4c,0xc3,0xe4,0x77,0x9a,0x95,0x60,0x32,0x62,0x95,0xe6,0xbe,0xfa,0x53,0x3f,0xa8,0x26,0x2c,0xd5,0xe5,
+  0x54,0x2c,0xb2,0x7c,0x8d,0x5d,0xae,0x44,0x56,0x26,0x5b,0x83,0x09,0x9e,0xc1,0x64,0x19,0xcb,0x85,0xe2,
+  0xf7,0x73,0x19,0x3a,0xe3,0x65,0xcd,0x78,0x74,0x52,0x15,0x91,0x8c,0x6a,0x72,0xf3,0x11,0x6b,0x2b,0xd6,
+  0x0e,0x2d,0xd6,0xcc,0x91,0x2e,0x35,0xf2,0x3d,0xd2,0xe2,0xcc,0xd8,0x45,0xcd,0x94,0x1c,0x34,0xe3,0x7e,
+  0x17,0x35,0x39,0x65,0xb6,0x58,0xc0,0x94,0x28,0x5d,0x23,0xc5,0xac,0xb4,0xed,0x6a,0xd4,0x3b,0x9a,0xa0,
+  0xa3,0xe6,0xf9,0x14,0xcb,0x50,0x69,0x63,0x57,0x2c,0x6a,0x20,0x34,0x9b,0x87,0x22,0x25,0x02,0xe2,0x84,
+  0xd1,0x68,0xda,0x18,0x0c,0x63,0xaa,0x68,0x61,0xa8,0x8d,0x84,0x6b,0xa7,0x2c,0xc4,0xb8,0x30,0x69,0x1d,
+  0x18,0xf3,0xd2,0x96,0xfa,0x75,0xbb,0xdd,0x4e,0x4f,0x91,0x2b,0x24,0xd7,0xe4,0x5d,0xc1,0x80,0x4a,0x80,
+  0xc4,0x56,0x6c,0x8f,0x76,0xd6,0x5a,0x68,0x44,0xf5,0xd1,0xa3,0x47,0xab,0x54,0x53,0xc6,0xb8,0x32,0x36,
+  0xc0,0x81,0x76,0xb1,0xbd,0xde,0x57,0xb5,0x1a,0x19,0x02,0x42,0x90,0xef,0xb4,0xa0,0xb5,0x5a,0x16,0x0f,
+  0x25,0xb7,0xd0,0x24,0xcd,0x3c,0x68,0xa4,0x98,0xb6,0x07,0xaf,0x96,0x12,0xcc,0x81,0x44,0x40,0x01,0x25,
+  0x58,0xe1,0x0f,0xbe,0xe7,0x30,0x7a,0xe8,0xcc,0x38,0xe8,0x0c,0xa0,0xd0,0x66,0x80,0xff,0x0c,0x1e,0xa4,
+  0x6e,0xef,0x78,0x63,0x11,0xcc,0x18,0x52,0xec,0x35,0x7c,0xf4,0x78,0x03,0x48,0xc8,0xc6,0x53,0xcf,0x12,
+  0x33,0x04,0xb5,0x07,0xe4,0xe5,0x3c,0x9c,0x08,0x7c,0x7c,0x8c,0x04,0x9e,0x42,0x2f,0xcd,0xd8,0xd8,0xe1,
+  0xae,0x0d,0x21,0x46,0x8d,0xe6,0xf2,0x09,0xf7,0xec,0xc1,0xba,0x6e,0xbd,0x86,0x69,0x80,0x6d,0x13,0x89,
+  0x02,0xb1,0xc0,0x12,0xec,0xcf,0x46,0xdc,0x4d,0xba,0xbf,0x78,0xfe,0xe4,0xa4,0x0b,0x9d,0x54,0xa9,0x6e,
+  0xa1,0x60,0xd7,0xb1,0xfb,0x01,0x5b,0x44,0xf3,0x31,0x13,0x9e,0x00,0x40,0xd6,0x78,0x8a,0x94,0xb5,0x04,
+  0x1b,0x87,0xf8,0x9e,0x5b,0xdc,0x39,0xe7,0x36,0x39,0x83,0xe8,0x29,0x49,0xe5,0x40,0xaa,0xd9,0x11,0x8b,
+  0xea,0x9a,0xf1,0x24,0x3a,0x92,0x67,0xf1,0x77,0xa1,0xea,0x60,0xc2,0x87,0x32,0x88,0x31,0x9b,0x39,0xee,
+  0xb2,0x8b,0x6c,0x40,0x6b,0x8b,0x1f,0x5f,0x95,0x99,0x78,0x8e,0x98,0x37,0x71,0xf9,0x1a,0x06,0xa0,0x2e,
+  0x22,0xfb,0xeb,0xff,0xae,0x4a,0x58,0xfa,0x9c,0xdb,0xeb,0x24,0xf3,0xed,0x88,0x30,0xf9,0xe0,0x25,0x94,
+  0x7b,0x8d,0x44,0xb5,0xda,0x1a,0xb4,0x69,0x91,0x97,0x60,0xc2,0xb8,0x76,0x80,0x19,0x0b,0xa7,0xe4,0x09,
+  0xe0,0x2c,0xf9,0x66,0x0e,0x8e,0xe5,0xc9,0xf5,0x16,0xb1,0x62,0x9c,0x89,0x19,0x60,0x1b,0xa4,0xfd,0x83,
+  0xf3,0xad,0xa3,0xaa,0xc1,0x0e,0x49,0xe5,0xd4,0x75,0x60,0xbe,0xab,0x8a,0x9e,0x91,0xd0,0xcc,0xb8,0xf6,
+  0x64,0x15,0x85,0x01,0x68,0x63,0xb4,0x52,0xa1,0x20,0x0d,0x68,0x5f,0x8f,0x8f,0xc6,0x8f,0xc6,0xec,0x38,
+  0x82,0x2f,0x05,0xd2,0x08,0x42,0x52,0xb8,0x8e,0x1d,0x87,0xab,0x15,0x74,0x6b,0xab,0xd8,0xae,0xe7,0x27,
+  0x35,0x68,0x16,0x7e,0xf3,0x28,0xab,0xd4,0x5e,0x1b,0xf1,0x70,0xc1,0xb9,0x77,0x5c,0x08,0xce,0xab,0x10,
+  0x74,0x94,0x8c,0x84,0xee,0xdb,0x59,0x91,0x0f,0x44,0xd3,0x00,0x11,0x31,0x5a,0x1a,0x14,0xce,0x10,0xf8,
+  0x79,0x27,0xa6,0x32,0x52,0x5a,0x88,0xdc,0x22,0x0a,0x80,0x25,0x22,0x3c,0xcb,0x75,0xac,0x0f,0xfd,0x92,
+  0xf0,0xb9,0x87,0xfa,0x42,0x52,0x95,0x6a,0x69,0x80,0xcf,0xbd,0x86,0xee,0x66,0xa4,0x8e,0xac,0x2a,0x3b,
+  0x01,0xb0,0x98,0xe3,0x11,0x44,0xb7,0xea,0x47,0x29,0xce,0xb1,0x39,0xac,0x0e,0x02,0x01,0xe6,0xf9,0x02,
+  0x26,0x40,0x04,0x1f,0xba,0x88,0x65,0xaa,0x20,0x31,0xb2,0x92,0x0c,0xd9,0x3b,0x29,0x1d,0xfb,0x1d,0x2e,
+  0x3d,0x4b,0x03,0x00,0x56,0xd4,0x5b,0xbd,0x5e,0xcf,0xae,0x83,0x0a,0xa8,0x3e,0x1d,0xae,0x25,0xe8,0xf8,
+  0x57,0xa2,0xa4,0xad,0x6f,0x3d,0x7b,0xaa,0x7a,0x33,0xc5,0xc4,0xeb,0xa2,0x87,0xc8,0x80,0x4f,0x2c,0x8b,
+  0x4b,0x49,0x86,0x18,0x07,0xee,0xd0,0x6e,0xe9,0x11,0x7b,0xd8,0x39,0xf8,0x02,0xec,0xd6,0x30,0x5a,0x1a,
+  0xa4,0x27,0xe6,0x7a,0xe6,0x7a,0x32,0xbc,0x17,0x63,0x85,0xdd,0x42,0xed,0x94,0xb9,0x57,0xb6,0x44,0xe6,
+  0xdf,0xa2,0x21,0x02,0xb1,0x9b,0xd9,0x21,0xc6,0x4c,0x08,0xcf,0xfe,0x3c,0x24,0xad,0x3b,0xb4,0xc3,0xf1,
+  0xd8,0x6a,0x35,0x1f,0x7e,0x01,0x76,0xc8,0x0f,0x1f,0x72,0x4a,0xa1,0x6d,0x66,0x62,0x2a,0x67,0xa7,0xc3,
+  0x6b,0x82,0x27,0xd2,0x69,0xdd,0x81,0x41,0x0e,0x03,0x31,0x76,0x54,0xf8,0xcf,0x5b,0x85,0x37,0xe3,0xac,
+  0x75,0x75,0xe8,0x04,0x92,0xa1,0x80,0x79,0xd8,0x40,0xd3,0x37,0x4d,0xae,0x44,0xf7,0x3b,0x21,0xc3,0x0d,
+  0x34,0xa7,0x50,0x7d,0x35,0x3e,0x45,0xb0,0x89,0x1e,0x26,0x29,0x6e,0xcb,0xbf,0x34,0xc5,0xeb,0xb8,0x58,
+  0x81,0x83,0xd1,0x3f,0x1c,0xac,0xd8,0xc1,0x28,0xa9,0xbc,0x7e,0x7c,0x13,0x07,0xa3,0x9f,0xc0,0xc1,0xe8,
+  0x1d,0x38,0x18,0xbd,0x03,0x07,0xa3,0xb7,0xec,0x60,0xf4,0xd6,0x1d,0x8c,0x5e,0xcb,0xc1,0xf2,0x1b,0x0e,
+  0xb5,0xe4,0x55,0x1b,0x8c,0xe7,0x2a,0x45,0x13,0xef,0x84,0x71,0xa0,0x85,0x33,0x76,0x54,0x71,0x29,0xd9,
+  0x08,0xe2,0xaf,0x95,0x3d,0x51,0x29,0x93,0xf7,0x28,0xa5,0x37,0x3f,0xd9,0x06,0xb8,0x3f,0x4f,0x59,0xa3,
+  0xfa,0x8d,0x0c,0xa8,0x31,0xd0,0x1c,0x1f,0xe0,0x26,0x5a,0x1e,0x27,0x7b,0xbb,0xa2,0x71,0xa2,0x4d,0xb9,
+  0xe2,0x5a,0xf1,0x7f,0x2a,0x3c,0x4f,0xef,0xd8,0x53,0xb2,0xe7,0x4c,0xb8,0x28,0x43,0x91,0xe4,0x62,0x72,
+  0xe8,0x81,0xf8,0x30,0x6e,0x5b,0x76,0x16,0x3e,0xc8,0x56,0xfc,0x20,0xed,0x8c,0x5b,0x6b,0xf5,0x45,0x3c,
+  0x44,0x29,0x89,0xa3,0x83,0xc3,0x4e,0xb3,0x03,0xcd,0x5e,0x71,0x17,0x38,0x27,0xc6,0x71,0x48,0x28,0xc8,
+  0x6b,0xc9,0x63,0xa5,0xa7,0x0c,0x63,0x45,0x0a,0x95,0x06,0x53,0xb9,0xd3,0x15,0x60,0x9a,0x30,0xdf,0x24,
+  0x96,0x62,0x1e,0xe2,0xcd,0x6a,0xcf,0x51,0xd0,0x81,0xfb,0xeb,0x7e,0x09,0xd9,0x15,0xa5,0x58,0xcf,0xef,
+  0x60,0x72,0xf9,0xbb,0x66,0x49,0x27,0xae,0x93,0xa2,0x12,0x39,0x67,0xee,0x1c,0x4a,0xa0,0xca,0x9a,0x72,
+  0xeb,0x03,0xb7,0x07,0x31,0xbb,0xad,0xcc,0x7e,0xf7,0x4a,0x23,0xb5,0xd6,0x8f,0xd4,0x2a,0x25,0x23,0xd0,
+  0x95,0x11,0xf2,0xc6,0xbd,0x55,0xcf,0x34,0xa3,0x0f,0x4d,0x4d,0x99,0x4d,0x2c,0x05,0x81,0x8d,0xf7,0xab,
+  0xa7,0x8f,0xbb,0xab,0x63,0x69,0x21,0x14,0xdf,0x2d,0xb5,0xb5,0x2a,0x19,0x89,0x30,0xa7,0x5d,0xc2,0xa4,
+  0x9a,0xcb,0xbd,0x49,0x38,0xed,0x97,0xda,0xb4,0x14,0x0d,0xaf,0x93,0x74,0x2a,0x0b,0x19,0x5b,0xd7,0x61,
+  0x2a,0xc9,0x8d,0x9a,0xeb,0xa4,0x62,0x4c,0x31,0xde,0x5e,0x4b,0x88,0x21,0x78,0x09,0xac,0xb8,0xed,0xcd,
+  0x82,0xf8,0xd0,0x2a,0x12,0xc4,0x37,0x3d,0x32,0xc2,0x1c,0x76,0x6e,0x28,0xcc,0xcd,0xa5,0xa1,0x3b,0xa8,
+  0x84,0xde,0xbe,0x4a,0x08,0x78,0x92,0xc5,0xa7,0xc2,0x05,0x7f,0xee,0x97,0x2a,0x2e,0x67,0xe7,0x9c,0xf0,
+  0x99,0x1f,0x2e,0xd1,0x33,0xc1,0xd3,0xd8,0xc8,0xe5,0xd5,0x5b,0xd6,0x1c,0xdd,0x51,0x73,0xf4,0x53,0x68,
+  0xae,0x08,0x5d,0x8e,0x56,0xc8,0xac,0xc0,0x4d,0xb4,0x0c,0x89,0x71,0x5e,0xc2,0x2c,0xa2,0xc4,0xaf,0x78,
+  0x18,0x02,0x1b,0x12,0x90,0x3e,0xce,0xee,0x01,0xd5,0x6e,0x2b,0xe1,0xf0,0x68,0x75,0x09,0x17,0x6d,0xc6,
+  0x35,0x70,0xea,0x14,0x7a,0x74,0xdc,0xa1,0x4e,0x10,0x56,0xd0,0x17,0x45,0x8a,0x32,0xc6,0x51,0xc2,0x18,
+  0x50,0x16,0xf5,0xf8,0x80,0x9c,0xf8,0xbe,0xbb,0xcc,0x2e,0x77,0x0a,0xd8,0xcd,0x85,0xa5,0x9d,0x99,0xc5,
+  0x74,0xf4,0x0d,0x39,0x3d,0x65,0x9e,0xc5,0xdd,0x35,0x4b,0xb2,0x38,0x8a,0xa7,0xf2,0xc7,0x27,0xc3,0xb5,
+  0xe1,0x9b,0xf9,0x77,0x1d,0xbc,0x4f,0x86,0x37,0x08,0xdd,0x99,0x74,0x4e,0x64,0x1b,0x57,0x09,0xe0,0x45,
+  0x9e,0x65,0x72,0x0e,0xe4,0x05,0xc4,0x96,0x35,0xce,0x94,0xc6,0x0b,0x13,0x71,0x4c,0x5e,0xa2,0x14,0xb9,
+  0xb8,0x7d,0x55,0x2f,0xca,0x6e,0x3b,0x9a,0xf8,0xe7,0x36,0x30,0x11,0x94,0xbb,0x03,0x32,0x30,0xff,0x4b,
+  0x46,0x86,0x93,0xe1,0x97,0x84,0x0b,0x89,0xc5,0x7f,0xd6,0xa8,0x90,0xc9,0xc4,0xac,0xc3,0x07,0xb5,0x51,
+  0xbf,0x6b,0x88,0x50,0xb9,0x9c,0x1b,0xa0,0x44,0x5a,0x92,0x1b,0x83,0xc3,0x7a,0x50,0xc0,0xf9,0xf0,0x4d,
+  0xfe,0xe7,0xee,0x56,0x14,0xbc,0x3e,0xa9,0x93,0x7f,0x30,0x6b,0x1a,0xb2,0x9b,0x2f,0x22,0x52,0x3b,0xe3,
+  0xac,0x44,0x52,0xef,0x29,0x8c,0x48,0x6a,0x77,0x7c,0x5d,0xe7,0x57,0xf4,0x84,0xaf,0x0e,0x44,0x0c,0x56,
+  0x86,0x96,0x5f,0x1a,0x9c,0x9d,0x0e,0x49,0xc5,0xd2,0xdb,0x2e,0x5c,0x1a,0x49,0x1e,0x9c,0xf3,0xa0,0xda,
+  0x6b,0xe8,0xb6,0x6b,0x3b,0xcf,0x6d,0xe8,0xfc,0xfa,0x31,0x74,0x76,0x1d,0x09,0xd6,0x44,0xc6,0x22,0x20,
+  0xa3,0x00,0xb6,0xb0,0x16,0x93,0xa1,0xdc,0x4e,0x60,0x1a,0x86,0x40,0xe1,0xbb,0xb3,0x33,0x20,0xe1,0x0b,
+  0xd7,0x8d,0xde,0xff,0xc0,0x33,0xd7,0x5c,0x6f,0x30,0x33,0x35,0x15,0x37,0x9e,0x6a,0x4c,0x16,0x90,0x13,
+  0xdb,0x0e,0x20,0x60,0x6d,0x36,0x20,0x95,0x37,0x58,0x67,0x40,0xd7,0x01,0xe1,0x02,0x03,0x6a,0x3d,0xa2,
+  0xf5,0xd6,0xe1,0x51,0x1d,0xfe,0x6d,0x75,0x0e,0x6e,0xc1,0x90,0x74,0xea,0x62,0x83,0x54,0x2a,0x7b,0x61,
+  0xa4,0xf2,0xe6,0xb3,0x11,0x78,0x27,0x99,0x39,0x1e,0x6e,0xd5,0x50,0x3e,0x90,0xec,0xe0,0xa0,0x7d,0x70,
+  0x2b,0xc2,0x1d,0xc2,0x3f,0xf7,0x14,0x79,0x14,0x34,0x7d,0x49,0xc1,0x27,0x83,0xa5,0x5f,0x4a,0xfc,0xa1,
+  0x1b,0xe3,0x0f,0xbd,0x8f,0xf8,0x43,0x6f,0x27,0xfe,0xd0,0xbb,0x8e,0x3f,0xf4,0x5e,0xe2,0xcf,0x4b,0x9f,
+  0x7b,0x43,0x17,0xf8,0x34,0x6f,0xb6,0xdc,0x7d,0x10,0xa2,0x7f,0x04,0xa1,0x7b,0x0c,0x42,0xf4,0x5e,0x83,
+  0x50,0xab,0x0e,0xfd,0xef,0x3e,0x06,0xd1,0xfb,0x8c,0x41,0xad,0x66,0xab,0xd5,0xbc,0xc7,0x20,0x44,0xbf,
+  0xb4,0x20,0x44,0x3f,0xfb,0x20,0x24,0xad,0xc0,0xf1,0xc1,0xe7,0x1a,0x0d,0x13,0x79,0x30,0x7a,0x04,0xc2,
+  0x25,0xe3,0xb9,0xa7,0x4e,0x0a,0xe4,0x5e,0xf4,0x44,0xb2,0xef,0xec,0x90,0x8f,0xc4,0x16,0xd6,0x7c,0x06,
+  0xa1,0xa6,0x3e,0xe1,0xe1,0x13,0x97,0xe3,0xe3,0x37,0xcb,0xa7,0x76,0xa5,0x1c,0x1f,0x88,0x94,0xab,0x75,
+  0x15,0x32,0x9e,0x01,0x80,0xd4,0x41,0xe6,0x4a,0x19,0x5f,0x24,0x2d,0x57,0x8f,0x09,0x1e,0xc7,0x64,0x93,
+  0x5d,0xc7,0xe4,0x32,0x19,0x6b,0x35,0xb9,0x74,0xf5,0xd1,0x02,0x3e,0x13,0xe7,0x3c,0x19,0xf0,0x32,0x2f,
+  0x08,0xbe,0xcd,0xb1,0x89,0xb0,0x49,0x0c,0x6d,0x16,0x22,0xbd,0x2f,0xcf,0x8b,0x10,0xef,0x83,0xaf,0x3a,
+  0xce,0x0e,0xec,0x9b,0xe3,0xff,0x4d,0x94,0x93,0xad,0xeb,0x66,0x21,0x56,0x96,0x78,0x79,0x39,0xd2,0x4b,
+  0xaa,0x6b,0x0c,0xb8,0xa3,0x34,0x74,0x3b,0x71,0xba,0xa3,0x34,0x74,0x9b,0x34,0x74,0x47,0x69,0xe8,0x2e,
+  0xd2,0xa0,0xff,0x3c,0x83,0x91,0x21,0xc2,0xe9,0x51,0xf5,0x8b,0xf6,0x6a,0x9d,0x24,0xf7,0x98,0x5c,0x7a,
+  0x56,0xec,0x51,0x05,0xa6,0xaf,0x5e,0xc3,0x0d,0x83,0xa5,0xfa,0x1b,0x5f,0xc8,0xf5,0x20,0x84,0x05,0xa4,
+  0x4f,0xd8,0x82,0xc1,0xda,0x6a,0xcc,0x43,0x6b,0x5a,0x29,0x37,0x98,0xef,0x34,0xa0,0x6e,0xec,0x4c,0xca,
+  0xea,0x6d,0xe5,0xa8,0xe5,0xfb,0xb8,0x65,0x50,0x7f,0x2f,0x85,0x57,0x31,0xb5,0x1b,0x3d,0x46,0x1f,0x2f,
+  0x95,0xc9,0x5f,0x48,0xe5,0x7d,0x3d,0x2e,0x20,0x3f,0xfd,0x44,0x9a,0x55,0x10,0x56,0x1f,0x61,0x01,0xe1,
+  0x30,0x98,0xf3,0x6d,0xe4,0xf4,0xa9,0x0f,0xcc,0x91,0x0a,0xfc,0xd0,0x09,0x28,0xea,0x32,0xa4,0x57,0x2e,
+  0x6f,0xef,0x8f,0xc9,0xb8,0xd5,0xfe,0x58,0xb6,0x5b,0x7f,0x5a,0x30,0x3e,0xbd,0xc2,0xf8,0xb4,0x60,0x7c,
+  0xba,0x32,0xfe,0x25,0xb1,0x18,0xaa,0x81,0xa3,0xc5,0xe0,0xbc,0x0b,0x97,0xd7,0x79,0x10,0x88,0xa0,0x52,
+  0x56,0xaa,0x57,0xcf,0xdd,0xf2,0x3e,0xe1,0xca,0x24,0x2e,0x8b,0xd4,0x9e,0x06,0x8b,0xfb,0x56,0xba,0x49,
+  0x7f,0x66,0xa4,0x34,0x65,0x4a,0x4a,0x7c,0xeb,0xb8,0x45,0xdb,0x9d,0x83,0xdb,0x13,0x77,0x05,0x56,0xee,
+  0x5b,0x62,0x93,0xa8,0xca,0x48,0x6c,0xca,0x94,0xc4,0x3a,0xc3,0x54,0xde,0x4e,0x45,0x2d,0xcb,0x53,0x64,
+  0x2a,0x8a,0x8e,0x2a,0x55,0x84,0x60,0x99,0x0d,0xb5,0xa1,0x78,0x26,0x16,0x3c,0x38,0x65,0x92,0xef,0xc2,
+  0x1a,0xae,0x3e,0x57,0x59,0xc3,0x32,0x45,0x31,0x9b,0xbb,0xd8,0x85,0x45,0x58,0xf6,0xad,0x52,0x53,0x9f,
+  0x54,0x21,0x35,0x4c,0x16,0xdc,0xae,0x56,0xe9,0x27,0xd4,0x2a,0x2d,0xd0,0x2a,0x4d,0xb4,0x9a,0xda,0xb7,
+  0x95,0xb7,0x93,0x2a,0x52,0x2d,0xbd,0x99,0x6a,0x69,0x81,0x6a,0x69,0xa2,0xda,0x5d,0x98,0xca,0x29,0x93,
+  0x26,0xca,0x54,0xab,0xee,0x6b,0x6a,0x13,0xe3,0x94,0x5a,0xca,0x26,0xcb,0xbb,0x15,0x05,0xe7,0x0f,0x21,
+  0xef,0x48,0xbf,0xba,0x16,0xbf,0xb1,0x83,0x06,0x1e,0x5f,0x90,0xd7,0xdf,0x3f,0x7b,0xc5,0x59,0x60,0x4d,
+  0x87,0x2c,0x60,0x33,0x59,0xf9,0x68,0x96,0xd7,0x71,0x6c,0xea,0x26,0x73,0xf6,0xaf,0x39,0x0f,0x96,0xfa,
+  0x9d,0x10,0x14,0x56,0x6d,0x80,0xde,0xac,0xbe,0x27,0xf1,0xb6,0x6b,0xa2,0x58,0x34,0x95,0xfb,0x11,0x45,
+  0x1d,0x9b,0xba,0x3b,0x47,0xb4,0x54,0x47,0x84,0xcb,0xee,0xce,0xa1,0x2c,0xee,0x48,0xb7,0x8e,0x48,0x8b,
+  0x47,0xa4,0x5b,0x47,0xa4,0x85,0x23,0x1a,0x64,0xef,0x26,0x20,0x1f,0xd5,0x18,0x04,0xec,0x26,0x60,0x98,
+  0xaa,0x51,0x86,0x6f,0xaa,0xd4,0x73,0xaa,0x0e,0x2d,0xb8,0x9b,0xe0,0x54,0xba,0x17,0xee,0x4a,0x13,0xcc,
+  0x89,0x6b,0x68,0x32,0x12,0xcd,0x8e,0x44,0x53,0x23,0xd1,0x95,0x91,0x68,0x32,0x12,0xcd,0x8e,0x44,0x93,
+  0x91,0xf4,0xa3,0xaa,0xb8,0x34,0x16,0x95,0xb5,0x47,0x34,0x64,0x6b,0x3c,0x01,0xe3,0xff,0x38,0xe3,0xe1,
+  0x54,0xd8,0xdd,0xf2,0xf0,0xe5,0xab,0x33,0xf8,0xad,0xf3,0x56,0xb2,0xfb,0xb1,0x7c,0xaa,0x53,0x65,0x35,
+  0xfc,0xf4,0xa6,0xdc,0x85,0x08,0xe9,0xc3,0x06,0x4e,0x7d,0xd6,0xd0,0xb8,0xa8,0x2d,0x16,0x8b,0x1a,0x7e,
+  0x90,0x54,0x9b,0x07,0x2e,0xf7,0x2c,0xb0,0x28,0xbb,0x7c,0xb9,0xaf,0x2c,0xb6,0x78,0xc4,0x80,0x9b,0x24,
+  0x4b,0xe4,0x00,0xb8,0x3e,0x7c,0xce,0xa5,0x64,0x13,0x58,0x2c,0xaa,0x77,0x19,0xe2,0xe5,0x21,0x72,0x67,
+  0x7f,0x05,0xcc,0x94,0xe5,0x5c,0x9d,0xef,0xc6,0x4e,0xb3,0xb2,0xf1,0x31,0x94,0x78,0x78,0xe6,0xcc,0xb8,
+  0x98,0x87,0x15,0x70,0xc8,0xfe,0x00,0x70,0x58,0xf3,0x09,0x6b,0x51,0x84,0xe4,0x4a,0x75,0x5f,0x7d,0x04,
+  0x58,0xcd,0xc1,0x42,0x86,0x87,0x27,0x0a,0x0f,0x08,0x2e,0xfa,0x78,0x7d,0xa6,0x4b,0x81,0x05,0x05,0x13,
+  0xe5,0x08,0x22,0x0a,0x00,0xe1,0x1e,0x96,0x2d,0x3b,0xc3,0x41,0x6c,0xd8,0xbb,0x2e,0x74,0xf6,0xf3,0x38,
+  0x92,0x5a,0xf0,0xe6,0x30,0x21,0x5e,0xba,0xe6,0x9c,0x3e,0x5e,0x94,0xe6,0xbc,0x3a,0x5e,0x6e,0xe6,0xdc,
+  0x36,0x5e,0x48,0xfe,0xe1,0x7d,0x9f,0xd4,0xfb,0x4e,0x86,0x24,0x3a,0xef,0xdf,0xe2,0x7b,0xf1,0x8e,0xfd,
+  0xb3,0xf0,0xbc,0xfb,0x59,0x41,0xef,0xec,0x7c,0xb1,0xf5,0xee,0xba,0xe6,0xce,0x1b,0xf7,0xce,0xeb,0xec,
+  0x9c,0xed,0xef,0xba,0x98,0xce,0xb9,0xc6,0xae,0xeb,0xe6,0xfb,0xf3,0x9c,0xdd,0x30,0x69,0x7d,0x0c,0xbf,
+  0x6b,0xb4,0xfa,0xc4,0x9e,0x9d,0x71,0x9d,0xcc,0x3b,0x1a,0x9b,0x7d,0x37,0x9d,0xa5,0xfa,0x6c,0xdc,0x97,
+  0x7e,0x86,0xee,0x7b,0x7f,0xc1,0x67,0xd7,0x6d,0x5c,0xde,0xc3,0x76,0xde,0xb5,0xe5,0x1c,0x70,0xd7,0xad,
+  0x59,0xce,0x3f,0x77,0xdd,0x93,0xfd,0xe1,0xbe,0xd7,0x72,0x5f,0xba,0x83,0xfb,0xd2,0x4f,0xe6,0xbe,0x89,
+  0xe3,0xa6,0xba,0xe2,0xb1,0xe0,0xbe,0x3a,0x4d,0x03,0xd7,0x2a,0xe3,0x0d,0x05,0xe5,0xaa,0xb9,0x34,0x01,
+  0x7d,0x8e,0x5f,0x38,0x12,0x7d,0x1b,0x2a,0xd7,0x27,0x91,0x45,0x08,0x96,0xa1,0xd9,0xd6,0xe2,0x3a,0x63,
+  0x52,0x89,0x7a,0x56,0x63,0x1a,0x51,0x5a,0xb9,0x7a,0x1c,0x93,0x9f,0xc9,0x0c,0x65,0x2b,0xe0,0x2c,0xe4,
+  0x86,0x78,0xa5,0x6c,0x3b,0xe7,0x9a,0x1e,0x34,0xab,0x3b,0x98,0xab,0xcd,0x8e,0x15,0x55,0xa1,0x0c,0x46,
+  0xa5,0x98,0xcf,0x85,0x5f,0x51,0x8d,0x3a,0x95,0xc2,0x5b,0x6f,0xce,0xa0,0x10,0xea,0xfe,0xb9,0x7a,0xc9,
+  0x08,0x49,0x8e,0xe7,0xf4,0xdd,0x13,0xd1,0x8f,0xf4,0xd5,0x23,0xad,0x95,0xcf,0x43,0x48,0x4b,0x1d,0x20,
+  0xae,0x7c,0xee,0xa1,0x0f,0xab,0xd2,0x17,0xb2,0x14,0x5c,0x90,0x91,0xf9,0xb0,0xe4,0x4f,0x1f,0xf5,0xbc,
+  0xf7,0xfb,0x89,0xb9,0x90,0xbf,0x92,0xb2,0x39,0xd2,0x2b,0x93,0x2e,0x49,0x1a,0x68,0x5d,0xaa,0x6a,0xdb,
+  0x6a,0x1f,0xe8,0xea,0xb2,0xf9,0x66,0xbd,0x7c,0x79,0x5c,0x70,0x09,0x88,0xe2,0x35,0x73,0x09,0x48,0xeb,
+  0xa0,0x7a,0xfc,0x4f,0x9c,0x9c,0x78,0xca,0xd1,0xac,0xc1,0x7b,0x7d,0xee,0xd9,0xa7,0x53,0xc7,0xb5,0x2b,
+  0x30,0x6d,0x6a,0xce,0x73,0x96,0xf9,0x51,0xa9,0x15,0x67,0xd5,0x67,0x01,0x74,0x7d,0x01,0x9e,0x51,0x55,
+  0xb3,0x1c,0xeb,0x95,0x80,0x9f,0xb4,0xb5,0xb5,0xea,0x54,0xcc,0xa9,0xba,0xdf,0x43,0x9f,0x12,0xc0,0xa4,
+  0x70,0x3c,0x9e,0x70,0xac,0x0f,0x68,0x50,0x40,0x18,0x5c,0x9c,0xef,0xe9,0xbb,0x20,0xf0,0x8c,0xe3,0xc9,
+  0x39,0x50,0x7d,0xa6,0x4e,0xe2,0x79,0x50,0x29,0xab,0x96,0xe0,0x49,0x68,0xee,0x38,0x3c,0xf0,0xf4,0x26,
+  0x75,0x14,0x06,0xe6,0x1d,0x1d,0x2b,0xc1,0x63,0xea,0x58,0xc6,0xfc,0x32,0xc7,0x1a,0x6f,0xeb,0xe0,0xcb,
+  0x4f,0x18,0x78,0x0d,0x1a,0xd0,0x20,0x13,0x98,0xf4,0x65,0x34,0xeb,0x2d,0xdb,0xb1,0x8d,0x97,0x2a,0x7b,
+  0xae,0x87,0x2c,0x80,0x06,0x4a,0x1b,0xaa,0x67,0x55,0xff,0xb5,0xfe,0xdc,0x64,0x4f,0x63,0x14,0xfe,0x97,
+  0x9c,0x9f,0xe8,0x8b,0x1d,0xd4,0xd5,0x20,0xe0,0x8a,0x3e,0x5e,0x3e,0x82,0x8e,0x5e,0x8f,0xdf,0x7c,0x26,
+  0x30,0xbb,0x24,0xe0,0x80,0xc3,0x0e,0xb4,0xe2,0x36,0x19,0x2d,0xc9,0x93,0x33,0x36,0x21,0x95,0x76,0xb3,
+  0x83,0x74,0xc0,0xb8,0x5c,0x4e,0xc0,0x99,0xa7,0xcc,0x9b,0x70,0x1b,0x10,0xc2,0x8a,0xbf,0x7b,0x52,0xf4,
+  0x39,0x14,0x00,0x08,0x90,0x71,0x20,0x66,0xea,0x2e,0x24,0x75,0x69,0x12,0x38,0x06,0xca,0x86,0xd1,0x39,
+  0xe0,0xbe,0xbb,0xac,0xef,0x65,0x92,0x9e,0xfa,0x3b,0x33,0xbc,0x3a,0xc4,0x84,0xf1,0x21,0xf4,0x76,0x24,
+  0xaf,0x43,0xd7,0xca,0x9b,0xa2,0xc8,0x5d,0x07,0xd2,0x5e,0x25,0xc0,0x59,0x8d,0xc2,0x35,0xf0,0x92,0x6e,
+  0x19,0x8f,0x58,0xdc,0xf8,0x6d,0x55,0xcd,0xae,0xae,0xaa,0xbc,0x79,0x0f,0x38,0xf4,0xb6,0x9a,0x28,0x89,
+  0x10,0x10,0x36,0xff,0x29,0xb1,0xa9,0xdb,0x7c,0x42,0x17,0x85,0xde,0x2c,0x34,0x6c,0xc8,0x8e,0x6f,0x25,
+  0x18,0x7d,0x5c,0x98,0x23,0xba,0x2e,0x57,0xfe,0x1a,0x9c,0x2a,0x93,0x50,0xdd,0x3a,0x84,0x09,0xdd,0x05,
+  0x3c,0x6f,0x4e,0x9b,0x6f,0xe7,0x5d,0x87,0xf6,0x02,0xc2,0xf9,0x0c,0xfa,0x0e,0xe4,0xb4,0x0d,0xe7,0x08,
+  0x86,0x75,0x10,0xfd,0x9d,0xb1,0x45,0xb0,0x5b,0x80,0xaa,0xdf,0x7f,0xfe,0x77,0xf4,0x51,0x1e,0x44,0x51,
+  0x04,0xac,0xdf,0x7f,0xfe,0x0f,0x79,0xec,0xc8,0xb8,0x55,0x3c,0x66,0xa1,0xca,0xcd,0xc7,0xad,0xbb,0xb0,
+  0x45,0xd7,0xaa,0x7c,0x63,0xea,0x7c,0x2b,0xd5,0x8d,0x7a,0x4f,0x27,0xd2,0xe7,0xf6,0xf5,0xf4,0x4e,0xd7,
+  0xea,0x3d,0x9f,0x53,0xdf,0xce,0xed,0x1a,0x4d,0x17,0xa6,0xd7,0x77,0xa0,0xb7,0x56,0xd5,0x20,0x6d,0x5e,
+  0xd5,0x1a,0xbc,0x01,0xc4,0x62,0x55,0xbf,0x10,0x21,0x71,0xe3,0xd2,0x63,0xb3,0x6e,0xd3,0x6e,0x6f,0x16,
+  0x33,0xe8,0xf0,0x5b,0x72,0xfb,0x71,0x3c,0x51,0x15,0x0a,0x3b,0x55,0x30,0x89,0xd1,0x53,0xae,0x0f,0x23,
+  0x58,0x0d,0x44,0xb2,0x10,0x07,0x04,0x81,0xda,0xc9,0x3c,0x14,0xb5,0x80,0x8f,0x03,0x2e,0xa7,0x11,0x30,
+  0xf3,0x73,0x0e,0x00,0x09,0x0b,0x39,0xcc,0xb6,0x00,0x5d,0x08,0x83,0x4f,0xf1,0xbd,0x13,0x80,0xe3,0x4a,
+  0x96,0xc6,0x3e,0xac,0x14,0x54,0xa8,0xeb,0x35,0xa2,0x97,0x4c,0xe2,0xb7,0x4e,0xc6,0x42,0x40,0x1f,0x7c,
+  0x1f,0xe5,0xd7,0xff,0x42,0x33,0x7a,0x40,0xfe,0x36,0x9f,0xb2,0xda,0x73,0x06,0x10,0x4f,0x9e,0xff,0xf6,
+  0x8b,0x07,0xeb,0x92,0xdf,0x7e,0x21,0x0f,0x66,0x36,0x93,0xd3,0x63,0x98,0x37,0x8b,0x7b,0x12,0xe6,0x11,
+  0x96,0x05,0x3c,0x20,0xcf,0x9f,0x9e,0xe1,0x17,0xba,0x86,0x46,0xf4,0x0e,0x0b,0x91,0x81,0xa5,0x6e,0xf4,
+  0x6b,0x76,0x9a,0xa3,0xd1,0x78,0xd4,0x51,0x37,0xfa,0xbd,0x97,0xea,0x0a,0xa4,0x98,0x01,0x75,0xa7,0x5f,
+  0xaf,0xa1,0xae,0x27,0xdc,0xfb,0x3f,0xe1,0xe9,0x4a,0xc0,0xb5,0x50,0x00,0x00
+};
+
+const char WEB_FOOTER_HTML[] PROGMEM =
+  "</div>\n"
+  "\n"
+  "<footer>\n"
+  "  © 2025 Juha-Matti Mäntylä &mdash; Licensed under MIT\n"
+  "</footer>\n"
+  "\n"
+  "<script src=\"/a/040bbfb4/app.js\"></script>\n"
+  "</body></html>\n";
+const char WEB_HEADER_HTML[] PROGMEM =
+  "<!doctype html><html><head>\n"
+  "<meta charset=\"UTF-8\">\n"
+  "<meta name=viewport content=\"width=device-width,initial-scale=1\">\n"
+  "<title>VDO Logic Wind adapter</title>\n"
+  "<link rel=stylesheet href=\"/a/6a448d2e/app.css\">\n"
+  "</head><body>\n"
+  "<div class=\"card\">\n"
+  "\n"
+  "<h1 style=\"text-align:center; margin-bottom:2px;\">VDO Wind Adapter</h1>\n"
+  "<div style=\"text-align:center; margin-top:-8px; margin-bottom:12px;\"><span class=\"small\">Bring your analog sensor into the digital age</span></div>\n"
+  "\n"
+  "<nav class=\"nav\">\n"
+  "  <a href=\"/\">Status</a>\n"
+  "  <a href=\"/display1\">Display 1</a>\n"
+  "  <a href=\"/display2\">Display 2</a>\n"
+  "  <a href=\"/display3\">Display 3</a>\n"
+  "</nav>\n";
+
+const WebAsset WEB_ASSETS[] = {
+  { "/a/6a448d2e/app.css", "text/css", WEB_APP_CSS_GZ, 653, 1650, "\"8f753e6f\"", true },
+  { "/a/040bbfb4/app.js", "application/javascript", WEB_APP_JS_GZ, 1281, 4046, "\"84e4b2c1\"", true },
+  { "/a/ecf978e0/display.css", "text/css", WEB_DISPLAY_CSS_GZ, 501, 1211, "\"ed8680c2\"", true },
+  { "/a/2647e5c2/display.js", "application/javascript", WEB_DISPLAY_JS_GZ, 1090, 3564, "\"d6b940d6\"", true },
+  { "/", "text/html", WEB_STATUS_HTML_GZ, 4015, 20661, "\"1a760a77\"", false },
+};
+const size_t WEB_ASSET_COUNT = sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]);
@@ -0,0 +1,24 @@
+// Generated by tools/build_web_assets.py from web/ - do not edit
+#pragma once
+#include <Arduino.h>
+
+struct WebAsset {
+  const char* path;        // Route
+  const char* type;
+  const uint8_t* gz;       // gzip body, PROGMEM
+  uint32_t gzLen;
+  uint32_t rawLen;         // Uncompressed size
+  const char* etag;
+  bool immutable;          // Hashed URL: cache for a year
+};
+
+#define WEB_APP_CSS_URL "/a/6a448d2e/app.css"
+#define WEB_APP_JS_URL "/a/040bbfb4/app.js"
+#define WEB_DISPLAY_CSS_URL "/a/ecf978e0/display.css"
+#define WEB_DISPLAY_JS_URL "/a/2647e5c2/display.js"
+
+extern const char WEB_FOOTER_HTML[] PROGMEM;
+extern const char WEB_HEADER_HTML[] PROGMEM;
+
+extern const WebAsset WEB_ASSETS[];
+extern const size_t WEB_ASSET_COUNT;
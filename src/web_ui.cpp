@@ -1,33 +1,55 @@
 // web_ui.cpp (Multi-page version)
 
 #include "web_ui.h"
+#include "web_assets.h"
+#include "page_writer.h"
+#include <esp_heap_caps.h>
+#include <esp_ota_ops.h>
 #include <Arduino.h>
 #include <WiFi.h>
 #include <WebServer.h>
 #include <Preferences.h>
+#include <ArduinoJson.h>
 
 // Yleinen osoitin WebServeriin
 static WebServer* g_srv = nullptr;
 
 // ---------- Page handlers (now using web_pages.cpp) ----------
 
-// Page handlers
-static void handleHome() {
-  g_srv->send(200, "text/html", buildStatusPage());
+// Static assets from web/ (tools/build_web_assets.py): gzip body, ETag.
+// Hashed CSS/JS URLs never change content, so browsers keep them a year;
+// pages revalidate and get a bodiless 304 while the firmware is unchanged.
+static void sendAsset(const WebAsset& a) {
+  g_srv->sendHeader("ETag", a.etag);
+  g_srv->sendHeader("Cache-Control", a.immutable ? "public, max-age=31536000, immutable" : "no-cache");
+  if (g_srv->header("If-None-Match") == a.etag) {
+    g_srv->send(304);
+    return;
+  }
+  g_srv->sendHeader("Content-Encoding", "gzip");
+  g_srv->send_P(200, a.type, (const char*)a.gz, a.gzLen);
 }
 
-static void handleDisplay1() {
-  g_srv->send(200, "text/html", buildDisplayPage(1));
-}
+// Page handlers
 
-static void handleDisplay2() {
-  g_srv->send(200, "text/html", buildDisplayPage(2));
-}
+// Heap peak per page request: streamed, and ?buffered=1 for comparison
+static PageHeapStats pageHeapChunked = {};
+static PageHeapStats pageHeapBuffered = {};
 
-static void handleDisplay3() {
-  g_srv->send(200, "text/html", buildDisplayPage(3));
+static void sendDisplayPage(int displayNum) {
+  if (g_srv->hasArg("buffered")) {
+    BufferedPageWriter out(*g_srv, "text/html", pageHeapBuffered);
+    renderDisplayPage(out, displayNum);
+  } else {
+    ChunkedPageWriter out(*g_srv, "text/html", pageHeapChunked);
+    renderDisplayPage(out, displayNum);
+  }
 }
 
+static void handleDisplay1() { sendDisplayPage(1); }
+static void handleDisplay2() { sendDisplayPage(2); }
+static void handleDisplay3() { sendDisplayPage(3); }
+
 // ---------- HTTP-käsittelijät ----------
 
 // API: Unified display endpoint
@@ -53,12 +75,7 @@ static void handleDisplayAPI() {
         bool newEnabled = g_srv->arg("val").toInt() != 0;
         displays[arrayIndex].enabled = newEnabled;
         saveDisplayConfig(arrayIndex);
-        
-        if (newEnabled) {
-          startDisplay(arrayIndex);
-        } else {
-          stopDisplay(arrayIndex);
-        }
+        requestDisplayRestart(arrayIndex);   // Output task starts or stops it
       }
       g_srv->send(200, "text/plain", String("enabled=") + (displays[arrayIndex].enabled ? "1" : "0"));
     } else {
@@ -73,6 +90,8 @@ static void handleDisplayAPI() {
       json += ",\"pulseDuty\":" + String(displays[arrayIndex].pulseDuty);
       json += ",\"pulsePin\":" + String(displays[arrayIndex].pulsePin);
       json += ",\"gotoAngle\":" + String(displays[arrayIndex].gotoAngle);
+      json += ",\"dacAddr\":" + String(displays[arrayIndex].dacAddr);
+      json += ",\"dacReady\":" + String(dacReady[arrayIndex] ? "true" : "false");
       json += "}";
       g_srv->send(200, "application/json", json);
     }
@@ -95,17 +114,20 @@ static void handleDisplayAPI() {
     if (g_srv->hasArg("pulseDuty")) displays[arrayIndex].pulseDuty = g_srv->arg("pulseDuty").toInt();
     if (g_srv->hasArg("pulsePin")) displays[arrayIndex].pulsePin = g_srv->arg("pulsePin").toInt();
     if (g_srv->hasArg("gotoAngle")) displays[arrayIndex].gotoAngle = g_srv->arg("gotoAngle").toInt();
+    bool dacChanged = false;
+    if (g_srv->hasArg("dacAddr")) {
+      // Decimal or 0x-prefixed; GP8403 lives at 0x58..0x5F, 0 = none
+      long a = strtol(g_srv->arg("dacAddr").c_str(), nullptr, 0);
+      uint8_t addr = (a >= 0x08 && a <= 0x77) ? (uint8_t)a : 0;
+      dacChanged = (addr != displays[arrayIndex].dacAddr);
+      displays[arrayIndex].dacAddr = addr;
+    }
     
     saveDisplayConfig(arrayIndex);
-    
-    // Restart display with new settings and update pulses
-    if (displays[arrayIndex].enabled) {
-      stopDisplay(arrayIndex);
-      startDisplay(arrayIndex);
-      updateDisplayPulse(arrayIndex);
-    } else {
-      stopDisplay(arrayIndex);
-    }
+    if (dacChanged) requestDacInit(arrayIndex);   // Output task owns the DAC
+    configEpoch.fetch_add(1);  // Output task re-applies offset/DAC
+    // Output task restarts the pulse output with the new settings
+    requestDisplayRestart(arrayIndex);
     
     g_srv->send(200, "text/plain", "OK");
   }
@@ -142,7 +164,7 @@ static void handleTrim(){
     if (v<-180) v=-180; if (v>180) v=180;
     offsetDeg = v;
     prefs.putInt("offset", offsetDeg);
-  setOutputsDeg(0, angleDeg); // TODO: käytä oikeaa displayNum:ia
+    configEpoch.fetch_add(1);  // Output task re-applies
   }
   g_srv->send(200, "text/plain", String("offset=")+offsetDeg);
 }
@@ -150,12 +172,12 @@ static void handleGoto(){
   if (g_srv->hasArg("deg")){
     int v = g_srv->arg("deg").toInt();
     if (v<0) v=0; if (v>359) v=359;
-    angleDeg = v;
-  setOutputsDeg(0, angleDeg); // TODO: käytä oikeaa displayNum:ia
+    windState.update([v](WindState& w) { w.angleDeg = v; w.angleCdeg = v * 100; });  // Output task applies it
+    feedDataWatchdog(STALE_ANGLE);  // Manual angle counts as fresh
   }
-  g_srv->send(200,"text/plain",String("angle=")+angleDeg);
+  g_srv->send(200,"text/plain",String("angle=")+windState.read().angleDeg);
 }
-static void handleSaveCfg(){ // POST: ssid, pass, ap_pass, p1_name, p1_proto, p1_host, p1_port, p2_name, p2_proto, p2_host, p2_port, wifi_mode, w1_ssid, w1_pass, w2_ssid, w2_pass
+static void handleSaveCfg(){ // POST: ssid, pass, ap_pass, p1_name, p1_proto, p1_host, p1_port, p2_name, p2_proto, p2_host, p2_port, wifi_mode, w1_ssid, w1_pass, w2_ssid, w2_pass, wake_mode, tcp_budget, udp_budget, out_hz, slew_dps, i2c_hz, pulse_mode, pulse_update, pulse_hyst
   if (g_srv->method() != HTTP_POST){
     g_srv->send(405, "text/plain", "Method Not Allowed");
     return;
@@ -186,6 +208,17 @@ static void handleSaveCfg(){ // POST: ssid, pass, ap_pass, p1_name, p1_proto, p1
   String w1_ssid = g_srv->arg("w1_ssid");
   String w1_pass = g_srv->arg("w1_pass");
 
+  // NMEA wake mode: "poll" (5 ms tick) or "select" (wake on data)
+  String wake_mode = g_srv->arg("wake_mode");
+  String tcp_budget = g_srv->arg("tcp_budget");
+  String udp_budget = g_srv->arg("udp_budget");
+  String out_hz = g_srv->arg("out_hz");
+  String slew_dps = g_srv->arg("slew_dps");
+  String pulse_mode = g_srv->arg("pulse_mode");
+  String pulse_update = g_srv->arg("pulse_update");
+  String pulse_hyst = g_srv->arg("pulse_hyst");
+  String i2c_hz = g_srv->arg("i2c_hz");
+
   // Pause NMEA polling task to prevent race condition
   extern volatile bool pauseNmeaPoll;
   pauseNmeaPoll = true;
@@ -221,6 +254,24 @@ static void handleSaveCfg(){ // POST: ssid, pass, ap_pass, p1_name, p1_proto, p1
   // WiFi Settings (single profile only)
   if (w1_ssid.length() > 0) prefs.putString("w1_ssid", w1_ssid);
   if (w1_pass.length() > 0) prefs.putString("w1_pass", w1_pass);
+  if (wake_mode.length() > 0) {
+    prefs.putUChar("wake_mode", wake_mode.equalsIgnoreCase("poll") ? NMEA_WAKE_POLL : NMEA_WAKE_SELECT);
+  }
+  if (tcp_budget.length() > 0) prefs.putUInt("tcp_budget", (uint32_t)tcp_budget.toInt());
+  if (udp_budget.length() > 0) prefs.putUInt("udp_budget", (uint32_t)udp_budget.toInt());
+  if (out_hz.length() > 0) prefs.putUInt("out_hz", (uint32_t)out_hz.toInt());
+  if (slew_dps.length() > 0) prefs.putUInt("slew_dps", (uint32_t)slew_dps.toInt());
+  if (i2c_hz.length() > 0) prefs.putUInt("i2c_hz", (uint32_t)i2c_hz.toInt());  // Applied on reboot
+  if (pulse_mode.length() > 0) {
+    uint8_t pm = PULSE_MODE_FRAC;
+    if (pulse_mode.equalsIgnoreCase("int")) pm = PULSE_MODE_INT;
+    else if (pulse_mode.equalsIgnoreCase("dds")) pm = PULSE_MODE_DDS;
+    prefs.putUChar("pulse_mode", pm);
+  }
+  if (pulse_update.length() > 0) {
+    prefs.putUChar("pulse_update", pulse_update.equalsIgnoreCase("now") ? PULSE_UPDATE_NOW : PULSE_UPDATE_PERIOD_END);
+  }
+  if (pulse_hyst.length() > 0) prefs.putUShort("pulse_hyst", (uint16_t)pulse_hyst.toInt());
 
   // Add to connection history if P1 changed
   if (p1_host.length() > 0 && p1_port.length() > 0) {
@@ -241,6 +292,8 @@ static void handleSaveCfg(){ // POST: ssid, pass, ap_pass, p1_name, p1_proto, p1
       prefs.putString("history_0", historyEntry);
     }
   }
+  // New /api/config ETag; kept in NVS so it never repeats across reboots
+  prefs.putUInt("cfg_ver", prefs.getUInt("cfg_ver", 0) + 1);
 
   prefs.end();
   
@@ -251,6 +304,8 @@ static void handleSaveCfg(){ // POST: ssid, pass, ap_pass, p1_name, p1_proto, p1
   // Reload configuration
   loadConfig();
   bindTransport();
+  // Pulse mode decides the LEDC timer binding; output task rebinds them
+  for (int i = 0; i < 3; i++) requestDisplayRestart(i);
 
   g_srv->send(200, "text/plain", "OK");
 }
@@ -273,119 +328,418 @@ static void handleReconnectTCP(){
   // Just report status
   g_srv->send(200, "text/plain", tcpConnected ? "connected" : "disconnected");
 }
+static const char* protoName(uint8_t p) {
+  return p == PROTO_TCP ? "tcp" : p == PROTO_HTTP ? "http" : "udp";
+}
+
+// JSON replies are built from RAM only (cfgSnap for stored settings) and
+// serialized into this buffer; the web server runs handlers one at a time
+#define JSON_REPLY_MAX  4096
+static char jsonReply[JSON_REPLY_MAX];
+
+static void sendJson(const JsonDocument& doc) {
+  size_t n = serializeJson(doc, jsonReply, sizeof(jsonReply));
+  if (doc.overflowed() || n >= sizeof(jsonReply) - 1) {
+    g_srv->send(500, "text/plain", "reply too large");
+    return;
+  }
+  g_srv->send_P(200, "application/json", jsonReply, n);
+}
+
 static void handleStatus(){
-  String rawEsc = lastSentenceRaw; rawEsc.replace("\"","\\\"");
-  String staSsidEsc = String(sta_ssid); staSsidEsc.replace("\"","\\\"");
-  
-  // Get AP client count
-  uint8_t apClientCount = WiFi.softAPgetStationNum();
-  
-  String j; j.reserve(600);
-  j += "{";
-  j += "\"angle\":";      j += lastAngleSent;
-  j += ",\"offset\":";      j += offsetDeg;
-  j += ",\"speed_kn\":";    j += sumlog_speed_kn;
-  j += ",\"displays\":[";
+  // ?nvs=1 re-reads the settings from NVS first, as every request used to
+  bool fromNvs = g_srv->hasArg("nvs");
+  StageTimer timer(stageHist[fromNvs ? STAGE_STATUS_NVS : STAGE_STATUS]);
+  if (fromNvs) {
+    prefs.begin("cfg", true);
+    loadConfigSnapshot();
+    prefs.end();
+  }
+  const ConfigSnapshot& c = cfgSnap;
+  WindState ws = windState.read();  // One consistent snapshot for the whole reply
+
+  JsonDocument doc;
+  doc["angle"] = lastAngleSent;
+  doc["offset"] = offsetDeg;
+  doc["speed_kn"] = ws.speedKn;
+  JsonArray disp = doc["displays"].to<JsonArray>();
   for (int i = 0; i < 3; i++) {
-    if (i > 0) j += ",";
-    j += "{\"enabled\":"; j += (displays[i].enabled ? "true" : "false");
-    j += ",\"type\":\""; j += displays[i].type; j += "\"";
-    j += ",\"sumlogK\":"; j += displays[i].sumlogK;
-    j += ",\"sumlogFmax\":"; j += displays[i].sumlogFmax;
-    j += ",\"pulseDuty\":"; j += displays[i].pulseDuty;
-    j += ",\"pulsePin\":"; j += displays[i].pulsePin;
-    j += "}";
+    JsonObject d = disp.add<JsonObject>();
+    d["enabled"] = displays[i].enabled;
+    d["type"] = (const char*)displays[i].type;
+    d["sumlogK"] = displays[i].sumlogK;
+    d["sumlogFmax"] = displays[i].sumlogFmax;
+    d["pulseDuty"] = displays[i].pulseDuty;
+    d["pulsePin"] = displays[i].pulsePin;
+    d["dac_addr"] = displays[i].dacAddr;
+    d["dac_ready"] = dacReady[i];
+    d["dac_writes"] = displayDacs[i].stats.writes;
+    d["dac_bus_us"] = displayDacs[i].stats.lastBusUs;
   }
-  j += "]";
-  j += ",\"src\":\"";      j += lastSentenceType; j += "\"";
-  j += ",\"raw\":\"";      j += rawEsc;  j += "\"";
-  j += ",\"has_mwv_r\":"; j += (hasMwvR ? "true" : "false");
-  j += ",\"has_mwv_t\":"; j += (hasMwvT ? "true" : "false");
-  j += ",\"has_vwr\":"; j += (hasVwr ? "true" : "false");
-  j += ",\"has_vwt\":"; j += (hasVwt ? "true" : "false");
-  j += ",\"port\":";      j += nmeaPort;
-  j += ",\"proto\":\"";      
-  j += (nmeaProto==PROTO_TCP?"TCP":nmeaProto==PROTO_HTTP?"HTTP":"UDP"); 
-  j += "\"";
-  j += ",\"host\":\"";      j += nmeaHost; j += "\"";
-  j += ",\"conn_profile\":\""; j += connProfileName; j += "\"";
-  j += ",\"conn_mode\":"; j += prefs.getUChar("conn_mode", 0);
-  j += ",\"p1_name\":\""; j += prefs.getString("p1_name", "Yachta"); j += "\"";
-  j += ",\"p1_proto\":\"";
-  uint8_t proto1 = prefs.getUChar("p1_proto", PROTO_TCP);
-  j += (proto1==PROTO_TCP?"tcp":proto1==PROTO_HTTP?"http":"udp");
-  j += "\"";
+  doc["src"] = nmeaKindName(ws.kind);
+  RawLine raw = rawLine.read();
+  doc["raw"] = (const char*)raw.text;
+  // Seen in the last rate window
+  doc["has_mwv_r"] = nmeaMetrics.rateHz[NMEA_KIND_MWV_R] > 0;
+  doc["has_mwv_t"] = nmeaMetrics.rateHz[NMEA_KIND_MWV_T] > 0;
+  doc["has_vwr"] = nmeaMetrics.rateHz[NMEA_KIND_VWR] > 0;
+  doc["has_vwt"] = nmeaMetrics.rateHz[NMEA_KIND_VWT] > 0;
+  doc["port"] = nmeaPort;
+  doc["proto"] = (nmeaProto==PROTO_TCP?"TCP":nmeaProto==PROTO_HTTP?"HTTP":"UDP");
+  doc["host"] = (const char*)nmeaHost;
+  doc["conn_profile"] = (const char*)connProfileName;
+  doc["conn_mode"] = c.connMode;
+  doc["p1_name"] = (const char*)c.p1Name;
+  doc["p1_proto"] = protoName(c.p1Proto);
   // Show CURRENT values if P1 is active, otherwise show stored values
-  uint8_t activeProfile = prefs.getUChar("conn_mode", 0);
-  if (activeProfile == 0) {
-    j += ",\"p1_host\":\""; j += nmeaHost; j += "\"";
-    j += ",\"p1_port\":"; j += nmeaPort;
-  } else {
-    j += ",\"p1_host\":\""; j += prefs.getString("p1_host", "192.168.68.145"); j += "\"";
-    j += ",\"p1_port\":"; j += prefs.getUShort("p1_port", 6666);
-  }
+  bool p1Active = (c.connMode == 0);
+  doc["p1_host"] = p1Active ? (const char*)nmeaHost : (const char*)c.p1Host;
+  doc["p1_port"] = p1Active ? nmeaPort : c.p1Port;
   // Always include stored values for editing (separate from display values)
-  j += ",\"p1_host_stored\":\""; j += prefs.getString("p1_host", "192.168.68.145"); j += "\"";
-  j += ",\"p1_port_stored\":"; j += prefs.getUShort("p1_port", 6666);
-  j += ",\"p1_proto_stored\":\"";
-  j += (proto1==PROTO_TCP?"tcp":proto1==PROTO_HTTP?"http":"udp");
-  j += "\"";
-  
-  j += ",\"p2_name\":\""; j += prefs.getString("p2_name", "OpenPlotter"); j += "\"";
-  j += ",\"p2_proto\":\"";
-  uint8_t proto2 = prefs.getUChar("p2_proto", PROTO_UDP);  // P2 defaults to UDP
-  j += (proto2==PROTO_TCP?"tcp":proto2==PROTO_HTTP?"http":"udp");
-  j += "\"";
+  doc["p1_host_stored"] = (const char*)c.p1Host;
+  doc["p1_port_stored"] = c.p1Port;
+  doc["p1_proto_stored"] = protoName(c.p1Proto);
+
+  doc["p2_name"] = (const char*)c.p2Name;
+  doc["p2_proto"] = protoName(c.p2Proto);
   // Show CURRENT values if P2 is active, otherwise show stored values
-  if (activeProfile == 1) {
-    j += ",\"p2_host\":\""; j += nmeaHost; j += "\"";
-    j += ",\"p2_port\":"; j += nmeaPort;
-  } else {
-    j += ",\"p2_host\":\""; j += prefs.getString("p2_host", ""); j += "\"";
-    j += ",\"p2_port\":"; j += prefs.getUShort("p2_port", 10110);
-  }
-  // Always include stored values for editing (separate from display values)
-  j += ",\"p2_host_stored\":\""; j += prefs.getString("p2_host", ""); j += "\"";
-  j += ",\"p2_port_stored\":"; j += prefs.getUShort("p2_port", 10110);
-  j += ",\"p2_proto_stored\":\"";
-  j += (proto2==PROTO_TCP?"tcp":proto2==PROTO_HTTP?"http":"udp");
-  j += "\"";
-  
+  bool p2Active = (c.connMode == 1);
+  doc["p2_host"] = p2Active ? (const char*)nmeaHost : (const char*)c.p2Host;
+  doc["p2_port"] = p2Active ? nmeaPort : c.p2Port;
+  doc["p2_host_stored"] = (const char*)c.p2Host;
+  doc["p2_port_stored"] = c.p2Port;
+  doc["p2_proto_stored"] = protoName(c.p2Proto);
+
   // Connection history (last 5 connections)
-  j += ",\"connection_history\":[";
-  for (int i = 0; i < 5; i++) {
-    String histKey = "history_" + String(i);
-    String histVal = prefs.getString(histKey.c_str(), "");
-    if (histVal.length() > 0) {
-      if (i > 0) j += ",";
-      j += "\""; j += histVal; j += "\"";
-    }
+  JsonArray hist = doc["connection_history"].to<JsonArray>();
+  for (int i = 0; i < CONN_HISTORY_LEN; i++) {
+    if (c.history[i][0]) hist.add((const char*)c.history[i]);
+  }
+
+  doc["tcp_connected"] = (bool)tcpConnected;
+  doc["udp_connected"] = (bool)udpConnected;
+  doc["sta_ip"] = WiFi.localIP().toString();
+  doc["sta_ssid"] = (const char*)sta_ssid;
+  doc["sta_connected"] = (WiFi.status() == WL_CONNECTED);
+  doc["ap_ssid"] = WiFi.softAPSSID();
+  doc["ap_ip"] = WiFi.softAPIP().toString();
+  doc["ap_clients"] = WiFi.softAPgetStationNum();
+  doc["w1_ssid"] = (const char*)c.w1Ssid;
+  doc["w1_pass"] = (const char*)c.w1Pass;
+  doc["w2_ssid"] = (const char*)c.w2Ssid;
+  doc["w2_pass"] = (const char*)c.w2Pass;
+  doc["ap_pass"] = (const char*)c.apPass;
+  doc["nmea_data_age"] = millis() - lastNmeaDataMs;
+  // Wind freshness per quantity and per display (watchdog state)
+  uint32_t stale = dataStale.load();
+  doc["angle_age"] = millis() - windFreshMs[0];
+  doc["speed_age"] = millis() - windFreshMs[1];
+  doc["angle_stale"] = (stale & STALE_ANGLE) != 0;
+  doc["speed_stale"] = (stale & STALE_SPEED) != 0;
+  JsonArray dstale = doc["disp_stale"].to<JsonArray>();
+  for (int i = 0; i < 3; i++) {
+    dstale.add(displays[i].enabled && (((stale & STALE_ANGLE) && dacReady[i]) ||
+                                       ((stale & STALE_SPEED) && ledcActive[i])));
+  }
+  doc["nmea_lines"] = tcpFramer.stats.lines + udpFramer.stats.lines;
+  doc["nmea_overruns"] = tcpFramer.stats.overruns + udpFramer.stats.overruns;
+  doc["nmea_bad_checksum"] = tcpFramer.stats.badChecksum + udpFramer.stats.badChecksum;
+  doc["nmea_corrupted"] = tcpFramer.stats.corrupted + udpFramer.stats.corrupted;
+  doc["wind_queue_dropped"] = windQueue.dropped.load();
+  doc["log_dropped"] = logRing.dropped.load();
+  doc["wake_mode"] = (nmeaWakeMode==NMEA_WAKE_SELECT?"select":"poll");
+  doc["wakeups"] = wakeStats.wakeups;
+  doc["idle_wakeups"] = wakeStats.idleWakeups;
+  doc["wake_to_parse_us"] = wakeStats.lastUs;
+  doc["wake_to_parse_avg_us"] = wakeStats.avgUs;
+  doc["wake_to_parse_max_us"] = wakeStats.maxUs;
+  doc["tcp_budget"] = tcpReadBudget;
+  doc["tcp_cycle_bytes"] = tcpStats.cycleBytes;
+  doc["tcp_cycle_bytes_max"] = tcpStats.maxCycleBytes;
+  doc["tcp_backlog"] = tcpStats.backlog;
+  doc["tcp_backlog_max"] = tcpStats.maxBacklog;
+  doc["tcp_budget_hits"] = tcpStats.budgetHits;
+  doc["tcp_delay_ms"] = tcpStats.lastDelayMs;
+  doc["tcp_delay_max_ms"] = tcpStats.maxDelayMs;
+  doc["out_hz"] = outputRateHz;
+  doc["slew_dps"] = slewMaxDps;
+  doc["i2c_hz"] = i2cHz;
+  doc["pulse_mode"] = (pulseMode==PULSE_MODE_DDS?"dds":pulseMode==PULSE_MODE_FRAC?"frac":"int");
+  doc["dds_ticks"] = (uint32_t)ddsStats.ticks;
+  doc["dds_isr_cycles"] = ddsStats.avgCycles16 >> 4;
+  doc["dds_isr_cycles_max"] = (uint32_t)ddsStats.maxCycles;
+  doc["pulse_update"] = (pulseUpdateMode==PULSE_UPDATE_PERIOD_END?"period":"now");
+  doc["pulse_hyst"] = pulseHystPermille;
+  JsonArray reprog = doc["pulse_reprog_per_s"].to<JsonArray>();
+  for (int i = 0; i < 3; i++) reprog.add(pulseStats[i].reprogramsPerSec);
+  JsonArray pmhz = doc["pulse_mhz"].to<JsonArray>();
+  for (int i = 0; i < 3; i++) pmhz.add(lastFreq[i]);
+  // DAC totals over all displays
+  DacOutputStats ds = {};
+  for (int i = 0; i < 3; i++) {
+    const DacOutputStats& s = displayDacs[i].stats;
+    ds.writes += s.writes;
+    ds.skipped += s.skipped;
+    ds.errors += s.errors;
+    if (s.lastBusUs > ds.lastBusUs) ds.lastBusUs = s.lastBusUs;
+    if (s.maxBusUs > ds.maxBusUs) ds.maxBusUs = s.maxBusUs;
+  }
+  doc["dac_writes"] = ds.writes;
+  doc["dac_skipped"] = ds.skipped;
+  doc["dac_errors"] = ds.errors;
+  doc["dac_bus_us"] = ds.lastBusUs;
+  doc["dac_bus_max_us"] = ds.maxBusUs;
+  doc["udp_budget"] = udpDrainBudget;
+  doc["udp_rx"] = udpStats.received;
+  doc["udp_rx_per_s"] = udpStats.receivedPerSec;
+  doc["udp_processed_per_s"] = udpStats.processedPerSec;
+  doc["udp_queue_full_per_s"] = udpStats.queueFullPerSec;
+  doc["udp_dropped_per_s"] = udpStats.droppedPerSec;
+  doc["udp_budget_hits"] = udpStats.budgetHits;
+
+  sendJson(doc);
+}
+
+// Fast-changing state for the page refresh loop; settings are on /api/config
+static void handleTelemetry(){
+  WindState ws = windState.read();
+  JsonDocument doc;
+  doc["angle"] = lastAngleSent;
+  doc["speed_kn"] = ws.speedKn;
+  doc["src"] = nmeaKindName(ws.kind);
+  RawLine raw = rawLine.read();
+  doc["raw"] = (const char*)raw.text;
+  doc["has_mwv_r"] = nmeaMetrics.rateHz[NMEA_KIND_MWV_R] > 0;
+  doc["has_mwv_t"] = nmeaMetrics.rateHz[NMEA_KIND_MWV_T] > 0;
+  doc["has_vwr"] = nmeaMetrics.rateHz[NMEA_KIND_VWR] > 0;
+  doc["has_vwt"] = nmeaMetrics.rateHz[NMEA_KIND_VWT] > 0;
+  doc["proto"] = (nmeaProto==PROTO_TCP?"TCP":nmeaProto==PROTO_HTTP?"HTTP":"UDP");
+  doc["host"] = (const char*)nmeaHost;
+  doc["port"] = nmeaPort;
+  doc["tcp_connected"] = (bool)tcpConnected;
+  doc["udp_connected"] = (bool)udpConnected;
+  doc["nmea_data_age"] = millis() - lastNmeaDataMs;
+  uint32_t stale = dataStale.load();
+  doc["angle_stale"] = (stale & STALE_ANGLE) != 0;
+  doc["speed_stale"] = (stale & STALE_SPEED) != 0;
+  doc["sta_ip"] = WiFi.localIP().toString();
+  doc["sta_ssid"] = (const char*)sta_ssid;
+  doc["sta_connected"] = (WiFi.status() == WL_CONNECTED);
+  doc["ap_ssid"] = WiFi.softAPSSID();
+  doc["ap_ip"] = WiFi.softAPIP().toString();
+  doc["ap_clients"] = WiFi.softAPgetStationNum();
+  sendJson(doc);
+}
+
+// Stored settings; changes only on /savecfg, so clients revalidate by ETag.
+// The tag also carries the firmware's ELF hash: an update that changes the
+// reply format must not be answered with 304 for a body cached before it.
+static void handleConfig(){
+  static char build[9] = "";
+  if (!build[0]) esp_ota_get_app_elf_sha256(build, sizeof(build));
+  const ConfigSnapshot& c = cfgSnap;
+  char etag[32];
+  snprintf(etag, sizeof(etag), "\"c%lu-%s\"", (unsigned long)c.version, build);
+  g_srv->sendHeader("ETag", etag);
+  g_srv->sendHeader("Cache-Control", "no-cache");
+  if (g_srv->header("If-None-Match") == etag) {
+    g_srv->send(304);
+    return;
+  }
+  JsonDocument doc;
+  doc["version"] = c.version;
+  doc["conn_mode"] = c.connMode;
+  doc["wifi_mode"] = c.wifiMode;
+  doc["p1_name"] = (const char*)c.p1Name;
+  doc["p1_proto"] = protoName(c.p1Proto);
+  doc["p1_host"] = (const char*)c.p1Host;
+  doc["p1_port"] = c.p1Port;
+  doc["p2_name"] = (const char*)c.p2Name;
+  doc["p2_proto"] = protoName(c.p2Proto);
+  doc["p2_host"] = (const char*)c.p2Host;
+  doc["p2_port"] = c.p2Port;
+  JsonArray hist = doc["connection_history"].to<JsonArray>();
+  for (int i = 0; i < CONN_HISTORY_LEN; i++) {
+    if (c.history[i][0]) hist.add((const char*)c.history[i]);
+  }
+  doc["w1_ssid"] = (const char*)c.w1Ssid;
+  doc["w1_pass"] = (const char*)c.w1Pass;
+  doc["w2_ssid"] = (const char*)c.w2Ssid;
+  doc["w2_pass"] = (const char*)c.w2Pass;
+  doc["ap_pass"] = (const char*)c.apPass;
+  sendJson(doc);
+}
+
+// Per-stage latency histograms in µs; /timing?reset=1 clears them after reading
+static void handleTiming(){
+  uint32_t mhz = getCpuFrequencyMhz();
+  String j; j.reserve(900);
+  j += "{\"cpu_mhz\":"; j += mhz;
+  j += ",\"stages\":[";
+  for (int i = 0; i < STAGE_COUNT; i++) {
+    LatencySummary s = stageHist[i].summary();
+    if (i > 0) j += ",";
+    j += "{\"name\":\""; j += STAGE_NAMES[i]; j += "\"";
+    j += ",\"count\":"; j += s.count;
+    j += ",\"min_us\":"; j += String((float)s.min / mhz, 2);
+    j += ",\"avg_us\":"; j += String((float)s.avg / mhz, 2);
+    j += ",\"p50_us\":"; j += String((float)s.p50 / mhz, 2);
+    j += ",\"p99_us\":"; j += String((float)s.p99 / mhz, 2);
+    j += ",\"max_us\":"; j += String((float)s.max / mhz, 2);
+    j += "}";
   }
   j += "]";
-  
-  j += ",\"tcp_connected\":"; j += (tcpConnected?"true":"false");
-  j += ",\"udp_connected\":"; j += (udpConnected?"true":"false");
-  j += ",\"sta_ip\":\"";   j += WiFi.localIP().toString(); j += "\"";
-  j += ",\"sta_ssid\":\""; j += staSsidEsc; j += "\"";
-  j += ",\"sta_connected\":"; j += (WiFi.status() == WL_CONNECTED ? "true" : "false");
-  j += ",\"ap_ssid\":\"";  j += WiFi.softAPSSID(); j += "\"";
-  j += ",\"ap_ip\":\"";    j += WiFi.softAPIP().toString(); j += "\"";
-  j += ",\"ap_clients\":"; j += apClientCount;
-  j += ",\"w1_ssid\":\""; j += prefs.getString("w1_ssid", "Kontu"); j += "\"";
-  j += ",\"w1_pass\":\""; j += prefs.getString("w1_pass", "8765432A1"); j += "\"";
-  j += ",\"w2_ssid\":\""; j += prefs.getString("w2_ssid", ""); j += "\"";
-  j += ",\"w2_pass\":\""; j += prefs.getString("w2_pass", ""); j += "\"";
-  j += ",\"ap_pass\":\""; j += prefs.getString("ap_pass", "wind12345"); j += "\"";
-  j += ",\"nmea_data_age\":"; j += (millis() - lastNmeaDataMs);
+  // Page rendering heap and fragmentation
+  const PageHeapStats* ph[2] = { &pageHeapChunked, &pageHeapBuffered };
+  const char* pn[2] = { "chunked", "buffered" };
+  j += ",\"page_heap\":{";
+  for (int i = 0; i < 2; i++) {
+    if (i) j += ",";
+    j += "\""; j += pn[i]; j += "\":{\"requests\":"; j += ph[i]->requests;
+    j += ",\"last_peak\":"; j += ph[i]->lastPeak;
+    j += ",\"max_peak\":"; j += ph[i]->maxPeak; j += "}";
+  }
+  j += "}";
+  j += ",\"heap_free\":"; j += heap_caps_get_free_size(MALLOC_CAP_8BIT);
+  j += ",\"heap_min_free\":"; j += heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT);
+  j += ",\"heap_largest_block\":"; j += heap_caps_get_largest_free_block(MALLOC_CAP_8BIT);
   j += "}";
+  if (g_srv->hasArg("reset")) {
+    for (int i = 0; i < STAGE_COUNT; i++) stageHist[i].reset();
+  }
   g_srv->send(200, "application/json", j);
 }
 
+// ---------- Prometheus metrics ----------
+
+static void metricHeader(String& m, const char* name, const char* type, const char* help){
+  m += "# HELP "; m += name; m += ' '; m += help; m += '\n';
+  m += "# TYPE "; m += name; m += ' '; m += type; m += '\n';
+}
+
+static void metric(String& m, const char* name, const char* labels, uint32_t v){
+  m += name;
+  if (labels) { m += '{'; m += labels; m += '}'; }
+  m += ' '; m += v; m += '\n';
+}
+
+static void metricF(String& m, const char* name, const char* labels, float v){
+  m += name;
+  if (labels) { m += '{'; m += labels; m += '}'; }
+  m += ' '; m += String(v, 3); m += '\n';
+}
+
+// Labels per wind sentence kind, indexed by NmeaWindKind
+static const char* const KIND_LABELS[NMEA_KIND_COUNT] = {
+  nullptr,
+  "sentence=\"MWV\",ref=\"R\"",
+  "sentence=\"MWV\",ref=\"T\"",
+  "sentence=\"VWR\",ref=\"R\"",
+  "sentence=\"VWT\",ref=\"T\"",
+};
+
+// Text exposition format for scraping from the boat server
+static void handleMetrics(){
+  const NmeaMetrics& nm = nmeaMetrics;
+  String m; m.reserve(3000);
+
+  metricHeader(m, "nmea_sentences_total", "counter", "Valid wind sentences by type and reference");
+  for (int k = 1; k < NMEA_KIND_COUNT; k++) metric(m, "nmea_sentences_total", KIND_LABELS[k], nm.sentences[k]);
+  metricHeader(m, "nmea_sentence_rate_hz", "gauge", "Wind sentence arrival rate over the last 5 s");
+  for (int k = 1; k < NMEA_KIND_COUNT; k++) metricF(m, "nmea_sentence_rate_hz", KIND_LABELS[k], nm.rateHz[k]);
+
+  metricHeader(m, "nmea_rejected_total", "counter", "Validated lines not used as wind data, by reason");
+  metric(m, "nmea_rejected_total", "reason=\"checksum\"", nm.results[NMEA_BAD_CHECKSUM]);
+  metric(m, "nmea_rejected_total", "reason=\"malformed\"", nm.results[NMEA_MALFORMED]);
+  metric(m, "nmea_rejected_total", "reason=\"unknown\"", nm.results[NMEA_UNKNOWN_TYPE]);
+  metric(m, "nmea_rejected_total", "reason=\"not_nmea\"", nm.results[NMEA_NOT_NMEA]);
+
+  // Framer counters per transport
+  const NmeaFramerStats* fs[2] = { &tcpFramer.stats, &udpFramer.stats };
+  const char* tl[2] = { "transport=\"tcp\"", "transport=\"udp\"" };
+  metricHeader(m, "nmea_bytes_total", "counter", "Bytes read from the transport");
+  for (int t = 0; t < 2; t++) metric(m, "nmea_bytes_total", tl[t], fs[t]->bytes);
+  metricHeader(m, "nmea_lines_total", "counter", "Complete lines that passed the framer");
+  for (int t = 0; t < 2; t++) metric(m, "nmea_lines_total", tl[t], fs[t]->lines);
+  metricHeader(m, "nmea_checksum_failures_total", "counter", "Lines dropped by the framer for a bad checksum");
+  for (int t = 0; t < 2; t++) metric(m, "nmea_checksum_failures_total", tl[t], fs[t]->badChecksum);
+  metricHeader(m, "nmea_line_overruns_total", "counter", "Lines longer than the line buffer");
+  for (int t = 0; t < 2; t++) metric(m, "nmea_line_overruns_total", tl[t], fs[t]->overruns);
+  metricHeader(m, "nmea_corrupted_total", "counter", "Lines dropped for lost line ends or bad trailers");
+  for (int t = 0; t < 2; t++) metric(m, "nmea_corrupted_total", tl[t], fs[t]->corrupted);
+
+  metricHeader(m, "nmea_tcp_connect_attempts_total", "counter", "TCP connect attempts");
+  metric(m, "nmea_tcp_connect_attempts_total", nullptr, nm.tcpConnectAttempts);
+  metricHeader(m, "nmea_tcp_connect_failures_total", "counter", "Failed TCP connect attempts");
+  metric(m, "nmea_tcp_connect_failures_total", nullptr, nm.tcpConnectFailures);
+  metricHeader(m, "nmea_tcp_sessions_total", "counter", "TCP sessions established");
+  metric(m, "nmea_tcp_sessions_total", nullptr, nm.tcpSessions);
+  metricHeader(m, "nmea_tcp_session_seconds_total", "counter", "Summed duration of ended TCP sessions");
+  metricF(m, "nmea_tcp_session_seconds_total", nullptr, nm.tcpSessionMsTotal / 1000.0f);
+  metricHeader(m, "nmea_tcp_last_session_seconds", "gauge", "Duration of the last ended TCP session");
+  metricF(m, "nmea_tcp_last_session_seconds", nullptr, nm.tcpLastSessionMs / 1000.0f);
+  metricHeader(m, "nmea_tcp_current_session_seconds", "gauge", "Age of the current TCP session, 0 if down");
+  metricF(m, "nmea_tcp_current_session_seconds", nullptr,
+          tcpConnected ? (millis() - nm.tcpSessionStartMs) / 1000.0f : 0.0f);
+  metricHeader(m, "nmea_tcp_connected", "gauge", "1 while the TCP source is connected");
+  metric(m, "nmea_tcp_connected", nullptr, tcpConnected ? 1 : 0);
+
+  metricHeader(m, "nmea_udp_datagrams_total", "counter", "UDP datagrams read / that yielded a valid line");
+  metric(m, "nmea_udp_datagrams_total", "state=\"received\"", udpStats.received);
+  metric(m, "nmea_udp_datagrams_total", "state=\"processed\"", udpStats.processed);
+  metricHeader(m, "nmea_udp_queue_full_total", "counter", "UDP drains that found the lwIP receive queue full");
+  metric(m, "nmea_udp_queue_full_total", nullptr, udpStats.queueFull);
+
+  static const char* const DISP_LABELS[3] = { "display=\"0\"", "display=\"1\"", "display=\"2\"" };
+  metricHeader(m, "pulse_reprograms_total", "counter", "LEDC timer reprograms");
+  for (int i = 0; i < 3; i++) metric(m, "pulse_reprograms_total", DISP_LABELS[i], pulseStats[i].reprograms);
+  metricHeader(m, "pulse_deferred_total", "counter", "Frequency changes queued for the end of the period");
+  for (int i = 0; i < 3; i++) metric(m, "pulse_deferred_total", DISP_LABELS[i], pulseStats[i].deferred);
+  metricHeader(m, "pulse_hysteresis_skips_total", "counter", "Frequency changes inside the hysteresis band");
+  for (int i = 0; i < 3; i++) metric(m, "pulse_hysteresis_skips_total", DISP_LABELS[i], pulseStats[i].hystSkips);
+
+  metricHeader(m, "pulse_dds_ticks_total", "counter", "DDS timer interrupts");
+  metric(m, "pulse_dds_ticks_total", nullptr, ddsStats.ticks);
+  metricHeader(m, "pulse_dds_isr_cycles", "gauge", "DDS interrupt cost in CPU cycles");
+  metric(m, "pulse_dds_isr_cycles", "stat=\"avg\"", ddsStats.avgCycles16 >> 4);
+  metric(m, "pulse_dds_isr_cycles", "stat=\"max\"", ddsStats.maxCycles);
+
+  metricHeader(m, "heap_free_bytes", "gauge", "Free 8-bit heap");
+  metric(m, "heap_free_bytes", nullptr, heap_caps_get_free_size(MALLOC_CAP_8BIT));
+  metricHeader(m, "heap_largest_free_block_bytes", "gauge", "Largest free heap block (fragmentation)");
+  metric(m, "heap_largest_free_block_bytes", nullptr, heap_caps_get_largest_free_block(MALLOC_CAP_8BIT));
+  metricHeader(m, "heap_min_free_bytes", "gauge", "Lowest free heap since boot");
+  metric(m, "heap_min_free_bytes", nullptr, heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT));
+  metricHeader(m, "http_page_heap_peak_bytes", "gauge", "Heap taken by the last page render");
+  metric(m, "http_page_heap_peak_bytes", "render=\"chunked\"", pageHeapChunked.lastPeak);
+  metric(m, "http_page_heap_peak_bytes", "render=\"buffered\"", pageHeapBuffered.lastPeak);
+
+  metricHeader(m, "nmea_data_age_seconds", "gauge", "Time since the last validated line");
+  metricF(m, "nmea_data_age_seconds", nullptr, (millis() - lastNmeaDataMs) / 1000.0f);
+  metricHeader(m, "wind_data_age_seconds", "gauge", "Time since wind data last fed the watchdog");
+  metricF(m, "wind_data_age_seconds", "quantity=\"angle\"", (millis() - windFreshMs[0]) / 1000.0f);
+  metricF(m, "wind_data_age_seconds", "quantity=\"speed\"", (millis() - windFreshMs[1]) / 1000.0f);
+  metricHeader(m, "wind_data_stale", "gauge", "1 while the data watchdog has zeroed/parked the quantity");
+  metric(m, "wind_data_stale", "quantity=\"angle\"", (dataStale.load() & STALE_ANGLE) ? 1 : 0);
+  metric(m, "wind_data_stale", "quantity=\"speed\"", (dataStale.load() & STALE_SPEED) ? 1 : 0);
+  metricHeader(m, "wind_queue_dropped_total", "counter", "Parsed samples dropped on a full output queue");
+  metric(m, "wind_queue_dropped_total", nullptr, windQueue.dropped.load());
+
+  g_srv->send(200, "text/plain; version=0.0.4", m);
+}
+
 void setupWebUI(WebServer& server){
   g_srv = &server;
   
+  // Static pages and hashed CSS/JS; If-None-Match is needed for 304s
+  static const char* hdrs[] = { "If-None-Match" };
+  server.collectHeaders(hdrs, 1);
+  for (size_t i = 0; i < WEB_ASSET_COUNT; i++) {
+    const WebAsset* a = &WEB_ASSETS[i];
+    server.on(a->path, HTTP_GET, [a]() { sendAsset(*a); });
+  }
+
   // Multi-page handlers
-  server.on("/",            HTTP_GET,  handleHome);
   server.on("/display1",    HTTP_GET,  handleDisplay1);
   server.on("/display2",    HTTP_GET,  handleDisplay2);
   server.on("/display3",    HTTP_GET,  handleDisplay3);
@@ -409,6 +763,10 @@ void setupWebUI(WebServer& server){
   server.on("/reconnect",   HTTP_GET,  handleReconnect);
   server.on("/reconnecttcp",HTTP_GET,  handleReconnectTCP);
   server.on("/status",      HTTP_GET,  handleStatus);
+  server.on("/api/telemetry", HTTP_GET, handleTelemetry);
+  server.on("/api/config",  HTTP_GET,  handleConfig);
+  server.on("/timing",      HTTP_GET,  handleTiming);
+  server.on("/metrics",     HTTP_GET,  handleMetrics);
   
   // Legacy display2 endpoints
   server.on("/display2enabled", HTTP_GET, [](void){
@@ -419,12 +777,7 @@ void setupWebUI(WebServer& server){
       if (newEnabled != displays[1].enabled) {
         displays[1].enabled = newEnabled;
         saveDisplayConfig(1);
-        
-        if (newEnabled) {
-          startDisplay(1); // Start unified display 1
-        } else {
-          stopDisplay(1);  // Stop unified display 1
-        }
+        requestDisplayRestart(1);
       }
     }
     g_srv->send(200, "text/plain", String("display2_enabled=") + (displays[1].enabled ? "1" : "0"));
@@ -436,7 +789,7 @@ void setupWebUI(WebServer& server){
         strncpy(displays[1].type, type.c_str(), sizeof(displays[1].type) - 1);
         displays[1].type[sizeof(displays[1].type) - 1] = '\0';
         saveDisplayConfig(1);
-        updateDisplayPulse(1); // Update pulse settings
+        requestDisplayRestart(1);   // New driver and pulse from the output task
       }
     }
     g_srv->send(200, "text/plain", String("display2_type=") + displays[1].type);
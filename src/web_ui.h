@@ -2,10 +2,124 @@
 #include <WebServer.h>
 #include <Preferences.h>
 #include <WiFi.h>
+#include <atomic>
+#include "nmea_framer.h"
+#include "wind_queue.h"
+#include "wind_state.h"
+#include "dac_output.h"
+#include "log_ring.h"
+#include "latency_hist.h"
+#include "needle_slew.h"
+
+// Instrumented hot-path stages (/timing)
+enum Stage {
+  STAGE_PARSE = 0,     // nmeaParse() of one line
+  STAGE_OUTPUT,        // setOutputsCdeg(): table lookup + DAC write
+  STAGE_PULSE,         // updateDisplayPulse()
+  STAGE_POLL_TCP,      // pollTCP(): drain + frame + parse
+  STAGE_POLL_UDP,      // pollUDP()
+  STAGE_STATUS,        // handleStatus() JSON build + send
+  STAGE_STATUS_NVS,    // Same with ?nvs=1: settings re-read from NVS first
+  STAGE_COUNT
+};
 
 // Enum protokollille
 enum { PROTO_UDP = 0, PROTO_TCP = 1, PROTO_HTTP = 2 };
 
+// How the NMEA task waits for socket data
+enum { NMEA_WAKE_POLL = 0, NMEA_WAKE_SELECT = 1 };
+
+// How pulse frequencies are generated: LEDC at whole Hz through
+// ledcChangeFrequency, LEDC with a fractional divider/resolution from
+// ledc_plan.h, or one timer interrupt running dds_engine.h for all displays
+enum { PULSE_MODE_INT = 0, PULSE_MODE_FRAC = 1, PULSE_MODE_DDS = 2 };
+
+// When a new period reaches the timer: right away (resets the counter
+// mid-pulse) or from the LEDC overflow interrupt at the end of the period
+enum { PULSE_UPDATE_NOW = 0, PULSE_UPDATE_PERIOD_END = 1 };
+#define PULSE_HYST_DEFAULT   10    // Permille of the running frequency
+#define PULSE_HYST_MAX       100
+
+// NMEA task wakeups and wake-to-parse time (µs). Starts at the wakeup, so
+// it leaves out how long the data waited in the socket before it: up to
+// NMEA_POLL_MS in poll mode, about nothing in select mode (woken by arrival).
+struct WakeStats {
+  uint32_t wakeups;        // Task wakeups
+  uint32_t idleWakeups;    // Woke without data (poll tick or select timeout)
+  uint32_t samples;        // Latency measurements taken
+  uint32_t lastUs;
+  uint32_t avgUs;          // Running average
+  uint32_t maxUs;
+};
+
+#define TCP_READ_BUDGET_DEFAULT  8192   // Bytes per NMEA task cycle
+
+// TCP drain per NMEA task cycle
+struct TcpIngestStats {
+  uint32_t cycleBytes;       // Read in the last cycle that had data
+  uint32_t maxCycleBytes;
+  uint32_t backlog;          // Still queued in the socket after that cycle
+  uint32_t maxBacklog;
+  uint32_t budgetHits;       // Cycles that stopped on the byte budget
+  uint32_t lastDelayMs;      // First seen pending -> socket drained
+  uint32_t maxDelayMs;
+  uint32_t backlogSinceMs;   // 0 = socket drained
+};
+
+#define PULSE_UPDATE_MS         50    // Min interval between pulse updates from the output task
+#define DATA_TIMEOUT_MS         4000  // No accepted wind data: zero speed, park needle
+
+// Quantities the data watchdog tracks; set in dataStale while timed out
+enum { STALE_ANGLE = 1, STALE_SPEED = 2 };
+
+// Sentence and TCP session counters (written by the NMEA task)
+struct NmeaMetrics {
+  uint32_t sentences[NMEA_KIND_COUNT];   // Valid wind sentences by kind
+  uint32_t results[NMEA_RESULT_COUNT];   // nmeaParse() outcomes
+  float rateHz[NMEA_KIND_COUNT];         // Arrival rate over the last 5 s
+  uint32_t rateStartMs;
+  uint32_t tcpConnectAttempts;
+  uint32_t tcpConnectFailures;
+  uint32_t tcpSessions;
+  uint32_t tcpSessionStartMs;
+  uint32_t tcpLastSessionMs;             // Duration of the last ended session
+  uint32_t tcpSessionMsTotal;            // Sum over ended sessions
+};
+
+// Timer reprogramming per display (output task + LEDC overflow ISR)
+struct PulseStats {
+  volatile uint32_t reprograms;   // Timer writes, immediate or at period end; ++ under ledcPendingMux
+  uint32_t deferred;              // ...of which queued for the overflow ISR
+  uint32_t hystSkips;             // Changes inside the hysteresis band
+  uint32_t reprogramsPerSec;
+  uint32_t lastReprograms;
+  uint32_t rateStartMs;
+};
+
+// DDS timer interrupt cost, CPU cycles per tick
+struct DdsIsrStats {
+  volatile uint32_t ticks;
+  volatile uint32_t lastCycles;
+  volatile uint32_t maxCycles;
+  volatile uint32_t avgCycles16;  // Moving average x16
+};
+
+#define UDP_DRAIN_BUDGET_DEFAULT  32   // Datagrams per NMEA task cycle
+
+// UDP drain totals and per-second rates
+struct UdpIngestStats {
+  uint32_t received;         // Datagrams read from the socket
+  uint32_t processed;        // ...that yielded at least one valid line
+  uint32_t budgetHits;       // Cycles that stopped on the datagram budget
+  uint32_t queueFull;        // Drains that found the lwIP receive mailbox full
+  uint32_t dropped;          // lwIP UDP drops (only with LWIP_STATS)
+  uint32_t receivedPerSec;
+  uint32_t processedPerSec;
+  uint32_t queueFullPerSec;
+  uint32_t droppedPerSec;
+  uint32_t rateStartMs;
+};
+
 // Display configuration structure
 struct DisplayConfig {
   bool enabled;
@@ -17,14 +131,40 @@ struct DisplayConfig {
   int pulseDuty;         // Pulse duty %
   int pulsePin;          // GPIO pin
   int gotoAngle;         // Manual angle
+  uint8_t dacAddr;       // GP8403 I2C address for SIN/COS, 0 = no DAC
+};
+
+#define CONN_HISTORY_LEN  5
+
+// Stored settings shown on /status and /api/config, kept in RAM so requests
+// never touch NVS. Filled by loadConfig() (also after /savecfg); defaults as
+// /status had them.
+struct ConfigSnapshot {
+  uint32_t version;      // NVS "cfg_ver", bumped by every /savecfg; ETag of /api/config
+  uint8_t connMode;
+  uint8_t wifiMode;
+  char p1Name[32];
+  uint8_t p1Proto;
+  char p1Host[64];
+  uint16_t p1Port;
+  char p2Name[32];
+  uint8_t p2Proto;
+  char p2Host[64];
+  uint16_t p2Port;
+  char history[CONN_HISTORY_LEN][72];   // "host:port", newest first
+  char w1Ssid[33];
+  char w1Pass[65];
+  char w2Ssid[33];
+  char w2Pass[65];
+  char apPass[65];
 };
 
 // Global variables from wind_project.ino
 extern Preferences prefs;
 extern DisplayConfig displays[3];
+extern ConfigSnapshot cfgSnap;
 
 // FreeRTOS synchronization
-extern SemaphoreHandle_t dataMutex;
 extern SemaphoreHandle_t wifiMutex;
 extern SemaphoreHandle_t nvsMutex;
 extern SemaphoreHandle_t pauseAckSemaphore;
@@ -32,18 +172,15 @@ extern SemaphoreHandle_t pauseAckSemaphore;
 // LEDC variables
 extern const uint8_t LEDC_CHANNELS[3];
 extern bool ledcActive[3];
+extern uint32_t lastFreq[3];
 
-extern float sumlog_speed_kn;
+extern WindStateLock windState;
+extern RawLineLock rawLine;
+extern std::atomic<uint32_t> configEpoch;
 extern int offsetDeg;
-extern int angleDeg;
 extern int lastAngleSent;
-extern char lastSentenceType[];
-extern char lastSentenceRaw[];
 extern char connProfileName[];
-extern bool hasMwvR;
-extern bool hasMwvT;
-extern bool hasVwr;
-extern bool hasVwt;
+extern NmeaMetrics nmeaMetrics;
 extern bool freezeNMEA;
 extern uint8_t  nmeaProto;
 extern uint16_t nmeaPort;
@@ -54,6 +191,29 @@ extern char sta_ssid[];
 extern char sta_pass[];
 extern char ap_pass[];
 extern uint32_t lastNmeaDataMs;
+extern std::atomic<uint32_t> dataStale;
+extern uint32_t windFreshMs[2];
+extern NmeaFramer tcpFramer;
+extern NmeaFramer udpFramer;
+extern WindQueue windQueue;
+extern uint8_t nmeaWakeMode;
+extern WakeStats wakeStats;
+extern uint32_t tcpReadBudget;
+extern TcpIngestStats tcpStats;
+extern uint32_t udpDrainBudget;
+extern uint32_t outputRateHz;
+extern uint32_t slewMaxDps;
+extern DacOutput displayDacs[3];
+extern bool dacReady[3];
+extern LatencyHist stageHist[STAGE_COUNT];
+extern const char* const STAGE_NAMES[STAGE_COUNT];
+extern uint32_t i2cHz;
+extern uint8_t pulseMode;
+extern uint8_t pulseUpdateMode;
+extern uint16_t pulseHystPermille;
+extern PulseStats pulseStats[3];
+extern DdsIsrStats ddsStats;
+extern UdpIngestStats udpStats;
 
 // AP settings constants
 #define AP_SSID "VDO-Cal"
@@ -61,21 +221,31 @@ extern uint32_t lastNmeaDataMs;
 
 // Core funktiot
 extern void loadConfig();
+void loadConfigSnapshot();   // prefs must be open
 void nmeaPollTaskFunc(void *pvParameters);
+void outputTaskFunc(void *pvParameters);
 void saveDisplayConfig(int displayNum);
 void saveNetworkConfig(const char* ssid, const char* pass);
 void startDisplay(int displayNum);
 void stopDisplay(int displayNum);
 void updateDisplayPulse(int displayNum);
 void updateAllDisplayPulses();
+void resolveDisplayDriver(int displayNum);
+void requestDisplayRestart(int displayNum);
+void requestDacInit(int displayNum);
+void startDataWatchdog();
+void feedDataWatchdog(uint32_t bits);
 void setupWebUI(WebServer& server);
 void bindTransport();
 void connectSTA();
+void buildDacTable();
 void setOutputsDeg(int displayNum, int deg);
+void setOutputsCdeg(int displayNum, int32_t cdeg);
+bool initDisplayDac(int displayNum, int tries);
 
 // Page builders (web_pages.cpp)
-String buildPageHeader(String activeTab);
+String buildPageHeader();
 String buildPageFooter();
-String buildStatusPage();
 String buildNetworkPage();
-String buildDisplayPage(int displayNum);
+class PageWriter;
+void renderDisplayPage(PageWriter& out, int displayNum);
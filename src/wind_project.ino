@@ -3,17 +3,35 @@
 #include <WiFi.h>
 #include <WebServer.h>
 #include <Preferences.h>
+#include <lwip/sockets.h>
+#include <lwip/stats.h>
 #include "DFRobot_GP8403.h"
 #include "web_ui.h"
+#include "nmea_parser.h"
+#include "nmea_framer.h"
+#include "wind_queue.h"
+#include "wind_state.h"
+#include "dac_table.h"
+#include "dac_output.h"
+#include "needle_slew.h"
+#include "log_ring.h"
+#include "pulse_driver.h"
+#include "ledc_plan.h"
+#include <driver/ledc.h>
+#include <soc/ledc_struct.h>
+#include <soc/gpio_struct.h>
+#include <hal/cpu_hal.h>
+#include <esp_timer.h>
+#include "dds_engine.h"
 
 // LEDC for hardware PWM pulse generation
 #define LEDC_TIMER_RESOLUTION    10
 #define LEDC_BASE_FREQ           5000
+#define DDS_HW_TIMER             0      // Hardware timer for PULSE_MODE_DDS
 
 /* ========= Global Settings and Variables ========= */
 
 // FreeRTOS synchronization primitives for thread safety
-SemaphoreHandle_t dataMutex = NULL;      // Protects wind data (speed, angle)
 SemaphoreHandle_t wifiMutex = NULL;      // Protects WiFi operations
 SemaphoreHandle_t nvsMutex = NULL;       // Protects NVS (Preferences) access
 SemaphoreHandle_t pauseAckSemaphore = NULL;  // For Core 1 pause acknowledgment
@@ -22,19 +40,23 @@ Preferences prefs;
 
 // Unified display array (3 displays)
 DisplayConfig displays[3];
+ConfigSnapshot cfgSnap;    // Settings for /status, see loadConfigSnapshot()
 
 // LEDC channels for each display (0-2) with separate timers
 const uint8_t LEDC_CHANNELS[3] = {0, 1, 2};
 const uint8_t LEDC_TIMERS[3] = {0, 1, 2};
 bool ledcActive[3] = {false, false, false};
-uint32_t lastFreq[3] = {0, 0, 0};
+uint32_t lastFreq[3] = {0, 0, 0};   // mHz last programmed, 0 = stopped
+PulseDriver pulseDrivers[3];   // Resolved from displays[] by resolveDisplayDriver()
 
-// Wind data - protected by dataMutex
-float sumlog_speed_kn = 0.0;
-int angleDeg = 0;
+// Wind data: written by the output task (queued samples) and /goto, read
+// lock-free from any task. The raw line is written by the NMEA task.
+WindStateLock windState;
+RawLineLock rawLine;     // For the web UI only
+// Bumped by web handlers when offset/DAC settings change; the output task
+// re-applies the needle without a new wind sample
+std::atomic<uint32_t> configEpoch{0};
 int lastAngleSent = 0;
-char lastSentenceType[32] = "-";
-char lastSentenceRaw[256] = "-";
 
 #define AP_SSID           "VDO-Cal"
 #define AP_PASS           "wind12345"
@@ -46,8 +68,9 @@ char nmeaHost[64] = "192.168.4.1";
 WiFiClient tcpClient;
 uint32_t lastTcpAttempt = 0;
 
-// UDP client for OpenPlotter/secondary source
-WiFiUDP udpClient;
+// UDP socket for OpenPlotter/secondary source. A raw lwIP socket rather
+// than WiFiUDP so the NMEA task can select() on it together with TCP.
+int udpSock = -1;
 uint32_t lastUdpAttempt = 0;
 
 // Separate connection states for TCP and UDP
@@ -55,36 +78,90 @@ volatile bool tcpConnected = false;
 volatile bool udpConnected = false;
 
 char netBuf[1472];
+uint32_t tcpReadBudget = TCP_READ_BUDGET_DEFAULT;  // Max TCP bytes parsed per cycle
+TcpIngestStats tcpStats = {};
+uint32_t udpDrainBudget = UDP_DRAIN_BUDGET_DEFAULT;  // Max datagrams per cycle
+#ifndef CONFIG_LWIP_UDP_RECVMBOX_SIZE
+#define CONFIG_LWIP_UDP_RECVMBOX_SIZE  6   // ESP-IDF default
+#endif
+UdpIngestStats udpStats = {};
+static bool udpBudgetHit = false;         // Last pollUDP() stopped on udpDrainBudget
 char udpBuf[1472];
-char nmeaLineBuf[256] = {0};
-size_t nmeaLineBufLen = 0;
-uint32_t lastNmeaDataMs = 0;
+// One validating line assembler per transport so a partial TCP line and a
+// UDP datagram can never be spliced together
+NmeaFramer tcpFramer;
+NmeaFramer udpFramer;
+
+// Parsed samples from the NMEA task (producer) to the output stage (consumer)
+WindQueue windQueue;
+uint32_t lastNmeaDataMs = 0;   // Last validated line of any type
+
+// Data watchdog: one-shot timers re-armed by accepted wind data
+std::atomic<uint32_t> dataStale{STALE_ANGLE | STALE_SPEED};   // Nothing received yet
+uint32_t windFreshMs[2] = {0, 0};                             // Last feed: angle, speed
+static esp_timer_handle_t staleTimers[2];
+
+// Cycle-counter latency histograms per hot-path stage, served on /timing
+LatencyHist stageHist[STAGE_COUNT];
+const char* const STAGE_NAMES[STAGE_COUNT] = {
+  "parse", "output", "pulse", "poll_tcp", "poll_udp", "status", "status_nvs"
+};
 
 // FreeRTOS task for NMEA polling on Core 1
 TaskHandle_t nmeaPollTask = NULL;
+// FreeRTOS task applying the latest sample to DAC/LEDC at outputRateHz
+TaskHandle_t outputTask = NULL;
+// Low-priority task formatting log records to Serial
+TaskHandle_t loggerTask = NULL;
+uint32_t outputRateHz = OUTPUT_RATE_HZ_DEFAULT;
+uint32_t slewMaxDps = SLEW_DPS_DEFAULT;         // Needle slew limit, 0 = jump
 volatile bool pauseNmeaPoll = false;
 
+// How the NMEA task waits for data (NMEA_WAKE_POLL / NMEA_WAKE_SELECT)
+uint8_t nmeaWakeMode = NMEA_WAKE_SELECT;
+#define NMEA_POLL_MS          5     // Poll mode: fixed wake interval
+#define NMEA_SELECT_MAX_MS    100   // Select mode: wake at least this often for reconnects
+
+// Wake-to-parse time: from the task waking up to the first line parsed.
+// Excludes queueing before the wakeup (see WakeStats).
+WakeStats wakeStats = {};
+static uint32_t wakeUs = 0;
+static bool wakeMeasured = true;
+
 #define SDA_PIN   21
 #define SCL_PIN   22
-#define I2C_ADDR  0x5F
-#define I2C_HZ    100000
-
-DFRobot_GP8403 dac(&Wire, I2C_ADDR);
+#define DAC_ADDR_DEFAULT  0x5F   // GP8403 with A0-A2 high; display 1 by default
+#define I2C_HZ_DEFAULT  400000   // GP8403 supports fast mode; 100000 via "i2c_hz"
 
-const uint8_t CH_SIN = 0;
-const uint8_t CH_COS = 1;
+// One GP8403 per display (SIN ch 0, COS ch 1), address from DisplayConfig.dacAddr
+DacOutput displayDacs[3] = { DacOutput(&Wire), DacOutput(&Wire), DacOutput(&Wire) };
+bool dacReady[3] = {false, false, false};
+uint32_t i2cHz = I2C_HZ_DEFAULT;
+uint8_t pulseMode = PULSE_MODE_FRAC;
+uint8_t pulseUpdateMode = PULSE_UPDATE_PERIOD_END;
+uint16_t pulseHystPermille = PULSE_HYST_DEFAULT;
+PulseStats pulseStats[3] = {};
+DdsEngine ddsEngine = {};
+DdsIsrStats ddsStats = {};
+hw_timer_t* ddsTimer = nullptr;
+uint8_t startedMode[3];        // pulseMode each output was started with
+int startedPin[3];             // ...and its pin, in case the config changed since
+// Displays to stop/start again with their current config (bits 0..2) and
+// DACs to re-init at a new address (bits RESTART_DAC_SHIFT..). Web handlers
+// set bits; only the output task touches LEDC/DDS and the DAC objects.
+std::atomic<uint32_t> displayRestart{0};
+#define RESTART_DAC_SHIFT  8
 const int VMIN = 2000, VCEN = 4000, VAMP_BASE = 2000, VMAX = 6000;
 
+// SIN/COS mV per degree, rebuilt only when the calibration above changes
+DacPair dacTable[DAC_TABLE_SIZE];
+
 int offsetDeg = 0;
 char connProfileName[64] = "Yachta";
 bool freezeNMEA = false;
 
-// NMEA sentence type tracking (5s window)
-bool hasMwvR = false;
-bool hasMwvT = false;
-bool hasVwr = false;
-bool hasVwt = false;
-uint32_t lastFlagReset = 0;
+// Sentence, parse-error and TCP session counters for /metrics (NMEA task only)
+NmeaMetrics nmeaMetrics = {};
 
 char sta_ssid[33] = {0};
 char sta_pass[65] = {0};
@@ -94,16 +171,16 @@ WebServer server(80);
 
 // FreeRTOS task for NMEA polling on Core 1
 void nmeaPollTaskFunc(void *pvParameters) {
-  Serial.println("NMEA polling task started on Core 1");
+  LOG_INFO("NMEA polling task started on Core 1");
   
   // Wait for WiFi to be ready before attempting connections
-  Serial.println("Waiting for WiFi to be ready...");
+  LOG_INFO("Waiting for WiFi to be ready...");
   uint32_t wifiWaitStart = millis();
   while ((WiFi.status() != WL_CONNECTED && WiFi.softAPgetStationNum() == 0) && 
          millis() - wifiWaitStart < 30000) {
     vTaskDelay(pdMS_TO_TICKS(100));
   }
-  Serial.println("WiFi ready, starting NMEA polling (TCP + UDP)");
+  LOG_INFO("WiFi ready, starting NMEA polling (TCP + UDP)");
   
   // Set TCP client to non-blocking mode
   tcpClient.setTimeout(0);
@@ -122,6 +199,12 @@ void nmeaPollTaskFunc(void *pvParameters) {
         pollTCP(tcpClient);
         tcpConnected = true;
       } else {
+        if (tcpConnected) {
+          // Session just ended
+          uint32_t ms = millis() - nmeaMetrics.tcpSessionStartMs;
+          nmeaMetrics.tcpLastSessionMs = ms;
+          nmeaMetrics.tcpSessionMsTotal += ms;
+        }
         tcpConnected = false;
       }
       
@@ -130,9 +213,59 @@ void nmeaPollTaskFunc(void *pvParameters) {
       if(udpConnected) {
         pollUDP();
       }
+      updateUdpRates();
+      updateSentenceRates();
+
+      waitForNmeaData();
+    } else {
+      vTaskDelay(pdMS_TO_TICKS(NMEA_POLL_MS));
+    }
+  }
+}
+
+// Sleep until a socket is readable (select mode) or for one poll period
+void waitForNmeaData() {
+  // A cycle cut short by a read budget left input behind. Bytes already in
+  // WiFiClient's rx buffer do not make the fd readable, so select() would
+  // sleep on them for the full timeout: go straight to the next cycle.
+  bool pending = (tcpStats.backlog > 0 && tcpClient.connected()) || (udpBudgetHit && udpSock >= 0);
+  if (pending) {
+    taskYIELD();
+  } else if (nmeaWakeMode == NMEA_WAKE_SELECT) {
+    fd_set rfds;
+    FD_ZERO(&rfds);
+    int maxFd = -1;
+    int tcpFd = tcpClient.connected() ? tcpClient.fd() : -1;
+    if (tcpFd >= 0) { FD_SET(tcpFd, &rfds); maxFd = tcpFd; }
+    if (udpSock >= 0) { FD_SET(udpSock, &rfds); if (udpSock > maxFd) maxFd = udpSock; }
+
+    if (maxFd >= 0) {
+      struct timeval tv = { 0, NMEA_SELECT_MAX_MS * 1000 };
+      int r = select(maxFd + 1, &rfds, NULL, NULL, &tv);
+      if (r <= 0) wakeStats.idleWakeups++;
+    } else {
+      // Nothing to wait on yet: just pace the reconnect attempts
+      vTaskDelay(pdMS_TO_TICKS(NMEA_SELECT_MAX_MS));
+      wakeStats.idleWakeups++;
     }
-    vTaskDelay(pdMS_TO_TICKS(5));  // 5ms cycle = 200Hz = responsive for wind direction
+  } else {
+    vTaskDelay(pdMS_TO_TICKS(NMEA_POLL_MS));  // 5ms cycle = 200Hz
   }
+  wakeStats.wakeups++;
+  wakeUs = micros();
+  wakeMeasured = false;
+}
+
+// First line parsed after a wakeup closes the latency measurement
+static void noteWakeToParse() {
+  if (wakeMeasured) return;
+  wakeMeasured = true;
+  uint32_t us = micros() - wakeUs;
+  wakeStats.lastUs = us;
+  if (us > wakeStats.maxUs) wakeStats.maxUs = us;
+  // Running average, 1/16 weight per sample
+  wakeStats.avgUs = wakeStats.samples ? wakeStats.avgUs + ((int32_t)(us - wakeStats.avgUs) >> 4) : us;
+  wakeStats.samples++;
 }
 
 /* ========= Asetusten tallennus ========= */
@@ -152,6 +285,7 @@ void saveDisplayConfig(int displayNum = -1) {
       prefs.putInt((prefix + "pulseDuty").c_str(), displays[i].pulseDuty);
       prefs.putInt((prefix + "pulsePin").c_str(), displays[i].pulsePin);
       prefs.putInt((prefix + "gotoAngle").c_str(), displays[i].gotoAngle);
+      prefs.putUChar((prefix + "dacAddr").c_str(), displays[i].dacAddr);
     }
   } else if (displayNum >= 0 && displayNum < 3) {
     // Tallenna vain yksi display
@@ -165,6 +299,7 @@ void saveDisplayConfig(int displayNum = -1) {
     prefs.putInt((prefix + "pulseDuty").c_str(), displays[displayNum].pulseDuty);
     prefs.putInt((prefix + "pulsePin").c_str(), displays[displayNum].pulsePin);
     prefs.putInt((prefix + "gotoAngle").c_str(), displays[displayNum].gotoAngle);
+    prefs.putUChar((prefix + "dacAddr").c_str(), displays[displayNum].dacAddr);
   }
   
   prefs.end();
@@ -209,9 +344,28 @@ void loadConfig(){
     
     snprintf(key, sizeof(key), "%sgotoAngle", prefix);
     displays[i].gotoAngle = prefs.getInt(key, 0);
+    
+    snprintf(key, sizeof(key), "%sdacAddr", prefix);
+    displays[i].dacAddr = prefs.getUChar(key, i == 0 ? DAC_ADDR_DEFAULT : 0);
   }
   
   offsetDeg = prefs.getInt("offset", 0);
+  nmeaWakeMode = prefs.getUChar("wake_mode", NMEA_WAKE_SELECT);
+  i2cHz = prefs.getUInt("i2c_hz", I2C_HZ_DEFAULT);
+  if (i2cHz != 100000) i2cHz = 400000;
+  pulseMode = prefs.getUChar("pulse_mode", PULSE_MODE_FRAC);
+  if (pulseMode > PULSE_MODE_DDS) pulseMode = PULSE_MODE_FRAC;
+  pulseUpdateMode = prefs.getUChar("pulse_update", PULSE_UPDATE_PERIOD_END);
+  pulseHystPermille = prefs.getUShort("pulse_hyst", PULSE_HYST_DEFAULT);
+  if (pulseHystPermille > PULSE_HYST_MAX) pulseHystPermille = PULSE_HYST_MAX;
+  tcpReadBudget = prefs.getUInt("tcp_budget", TCP_READ_BUDGET_DEFAULT);
+  if (tcpReadBudget < 256) tcpReadBudget = 256;
+  udpDrainBudget = prefs.getUInt("udp_budget", UDP_DRAIN_BUDGET_DEFAULT);
+  if (udpDrainBudget < 1) udpDrainBudget = 1;
+  outputRateHz = prefs.getUInt("out_hz", OUTPUT_RATE_HZ_DEFAULT);
+  slewMaxDps = prefs.getUInt("slew_dps", SLEW_DPS_DEFAULT);
+  if (outputRateHz < OUTPUT_RATE_HZ_MIN) outputRateHz = OUTPUT_RATE_HZ_MIN;
+  if (outputRateHz > OUTPUT_RATE_HZ_MAX) outputRateHz = OUTPUT_RATE_HZ_MAX;
   
   // Load connection profile selection - DEPRECATED
   // Both profiles are now always active simultaneously (TCP + UDP)
@@ -274,12 +428,44 @@ void loadConfig(){
   s.toCharArray(sta_ssid, sizeof(sta_ssid));
   p.toCharArray(sta_pass, sizeof(sta_pass));
   ap.toCharArray(ap_pass, sizeof(ap_pass));
+  loadConfigSnapshot();
   prefs.end();
   
   Serial.printf("Network: Profile1 (TCP) %s:%u, Profile2 (UDP) port %u\n", 
     p1_host.c_str(), p1_port, p2_port);
 }
 
+static void prefsCopy(const char* key, const char* def, char* dst, size_t n) {
+  String v = prefs.getString(key, def);
+  strlcpy(dst, v.c_str(), n);
+}
+
+void loadConfigSnapshot() {
+  ConfigSnapshot& c = cfgSnap;
+  c.version = prefs.getUInt("cfg_ver", 0);
+  c.connMode = prefs.getUChar("conn_mode", 0);
+  c.wifiMode = prefs.getUChar("wifi_mode", 0);
+  if (c.wifiMode > 1) c.wifiMode = 0;   // 255 = never saved
+  prefsCopy("p1_name", "Yachta", c.p1Name, sizeof(c.p1Name));
+  c.p1Proto = prefs.getUChar("p1_proto", PROTO_TCP);
+  prefsCopy("p1_host", "192.168.68.145", c.p1Host, sizeof(c.p1Host));
+  c.p1Port = prefs.getUShort("p1_port", 6666);
+  prefsCopy("p2_name", "OpenPlotter", c.p2Name, sizeof(c.p2Name));
+  c.p2Proto = prefs.getUChar("p2_proto", PROTO_UDP);
+  prefsCopy("p2_host", "", c.p2Host, sizeof(c.p2Host));
+  c.p2Port = prefs.getUShort("p2_port", 10110);
+  for (int i = 0; i < CONN_HISTORY_LEN; i++) {
+    char key[12];
+    snprintf(key, sizeof(key), "history_%d", i);
+    prefsCopy(key, "", c.history[i], sizeof(c.history[i]));
+  }
+  prefsCopy("w1_ssid", "Kontu", c.w1Ssid, sizeof(c.w1Ssid));
+  prefsCopy("w1_pass", "8765432A1", c.w1Pass, sizeof(c.w1Pass));
+  prefsCopy("w2_ssid", "", c.w2Ssid, sizeof(c.w2Ssid));
+  prefsCopy("w2_pass", "", c.w2Pass, sizeof(c.w2Pass));
+  prefsCopy("ap_pass", AP_PASS, c.apPass, sizeof(c.apPass));
+}
+
 void saveNetworkConfig(const char* ssid, const char* pass) {
   if (!ssid || ssid[0] == '\0') return;  // älä kirjoita tyhjää
   prefs.begin("cfg", false);              // sama namespace kuin loadConfig()
@@ -307,38 +493,220 @@ void saveNetworkConfig(const char* ssid, const char* pass) {
 }
 
 /* ========= DAC ulostulo ========= */
-static inline int wrap360(int d){ d%=360; if(d<0) d+=360; return d; }
-static inline int mvClamp(int mv){ if(mv<VMIN) return VMIN; if(mv>VMAX) return VMAX; return mv; }
+void buildDacTable(){
+  DacCal cal = { VMIN, VCEN, VAMP_BASE, VMAX };
+  dacTableBuild(dacTable, cal);
+}
 
 void setOutputsDeg(int displayNum, int deg){
-  int adj = wrap360(deg + displays[displayNum].offsetDeg);
-  float r = adj * DEG_TO_RAD;
-  float s = sinf(r), c = cosf(r);
-  float amp = VAMP_BASE;
-  int sin_mV = mvClamp(VCEN + (int)lroundf(amp * s));
-  int cos_mV = mvClamp(VCEN + (int)lroundf(amp * c));
-  dac.setDACOutVoltage(sin_mV, CH_SIN);
-  dac.setDACOutVoltage(cos_mV, CH_COS);
-  
-  // Track direction changes
-  if (adj != lastAngleSent) {
-    Serial.printf("Direction: %d° (sin:%dmV cos:%dmV)\n", adj, sin_mV, cos_mV);
+  setOutputsCdeg(displayNum, (int32_t)deg * 100);
+}
+
+// Sub-degree version used by the needle interpolation (centidegrees)
+void setOutputsCdeg(int displayNum, int32_t cdeg){
+  if (!dacReady[displayNum]) return;
+  StageTimer timer(stageHist[STAGE_OUTPUT]);
+  int32_t adjC = wrap36000(cdeg + (int32_t)displays[displayNum].offsetDeg * 100);
+  DacPair mv = dacTableLookup(dacTable, adjC);
+  displayDacs[displayNum].write(mv.sin_mV, mv.cos_mV);  // One transaction, skipped if unchanged
+}
+
+// Probe the display's GP8403 and set its 0-10 V range; false if absent
+bool initDisplayDac(int displayNum, int tries){
+  if (displayNum < 0 || displayNum >= 3) return false;
+  uint8_t addr = displays[displayNum].dacAddr;
+  dacReady[displayNum] = false;
+  displayDacs[displayNum].setAddress(addr);
+  if (addr == 0) return false;
+
+  DFRobot_GP8403 drv(&Wire, addr);   // Init and output range only
+  int n = 0;
+  while (drv.begin() != 0 && ++n < tries) {
+    Serial.printf("GP8403 0x%02X init error\n", addr);
+    delay(200);
+  }
+  if (n >= tries) {
+    Serial.printf("Display %d GP8403 0x%02X init FAILED - continuing without DAC\n", displayNum, addr);
+    return false;
   }
-  lastAngleSent = adj;
+  drv.setDACOutRange(drv.eOutputRange10V);
+  dacReady[displayNum] = true;
+  Serial.printf("Display %d GP8403 0x%02X init OK\n", displayNum, addr);
+  return true;
 }
 
 /* ========= LEDC Pulse Generation ========= */
+// IDF handles for an Arduino LEDC channel number
+static inline ledc_mode_t ledcModeOf(int displayNum) {
+  return (ledc_mode_t)(LEDC_CHANNELS[displayNum] / 8);
+}
+static inline ledc_channel_t ledcChanOf(int displayNum) {
+  return (ledc_channel_t)(LEDC_CHANNELS[displayNum] % 8);
+}
+
+// Own timer per display and plan-based programming; otherwise Arduino's whole-Hz calls
+static inline bool ledcDirect() {
+  if (pulseMode == PULSE_MODE_DDS) return false;
+  return pulseMode == PULSE_MODE_FRAC || pulseUpdateMode == PULSE_UPDATE_PERIOD_END;
+}
+
+// Settings waiting for the end of the running period
+struct LedcPending {
+  bool valid;
+  uint32_t divQ8;
+  uint8_t bits;
+  uint32_t duty;
+};
+static LedcPending ledcPending[3];
+static portMUX_TYPE ledcPendingMux = portMUX_INITIALIZER_UNLOCKED;
+static bool ledcIsrInstalled = false;
+
+// Overflow bit of a timer in LEDC int_* (hstimer0..3, then lstimer0..3)
+static inline uint32_t ledcOvfMask(int displayNum) {
+  return 1u << (ledcModeOf(displayNum) * 4 + LEDC_TIMERS[displayNum]);
+}
+
+static inline void ledcWriteRegs(int displayNum, const LedcPending& p) {
+  int g = LEDC_CHANNELS[displayNum] / 8, c = LEDC_CHANNELS[displayNum] % 8;
+  LEDC.timer_group[g].timer[LEDC_TIMERS[displayNum]].conf.clock_divider = p.divQ8;
+  LEDC.timer_group[g].timer[LEDC_TIMERS[displayNum]].conf.duty_resolution = p.bits;
+  LEDC.channel_group[g].channel[c].duty.duty = p.duty << 4;   // 4 fractional bits
+  LEDC.channel_group[g].channel[c].conf1.duty_start = 1;
+  if (g == LEDC_LOW_SPEED_MODE) {
+    LEDC.timer_group[g].timer[LEDC_TIMERS[displayNum]].conf.low_speed_update = 1;
+    LEDC.channel_group[g].channel[c].conf0.low_speed_update = 1;
+  }
+}
+
+// Timer overflow = period boundary: apply what the output task queued
+static void ledcOvfIsr(void*) {
+  uint32_t st = LEDC.int_st.val;
+  portENTER_CRITICAL_ISR(&ledcPendingMux);
+  for (int i = 0; i < 3; i++) {
+    uint32_t m = ledcOvfMask(i);
+    if (!(st & m)) continue;
+    LEDC.int_clr.val = m;
+    if (ledcPending[i].valid) {
+      ledcWriteRegs(i, ledcPending[i]);
+      ledcPending[i].valid = false;
+      pulseStats[i].reprograms++;
+    }
+    LEDC.int_ena.val &= ~m;          // Quiet until the next change
+  }
+  portEXIT_CRITICAL_ISR(&ledcPendingMux);
+}
+
+// Program a frequency from ledc_plan.h; false if it is below the LEDC range.
+// `atPeriodEnd` hands it to the overflow ISR so the running pulse completes.
+static bool ledcApplyMilliHz(int displayNum, uint32_t mHz, uint8_t dutyPct, bool atPeriodEnd) {
+  LedcPlan plan;
+  if (!ledcPlanFor(mHz, LEDC_TIMER_RESOLUTION, plan)) return false;
+  if (atPeriodEnd && ledcIsrInstalled) {
+    portENTER_CRITICAL(&ledcPendingMux);
+    ledcPending[displayNum] = { true, plan.divQ8, plan.bits, ledcPlanDuty(plan, dutyPct) };
+    LEDC.int_clr.val = ledcOvfMask(displayNum);   // Only a fresh overflow counts
+    LEDC.int_ena.val |= ledcOvfMask(displayNum);
+    portEXIT_CRITICAL(&ledcPendingMux);
+    pulseStats[displayNum].deferred++;
+    return true;
+  }
+  portENTER_CRITICAL(&ledcPendingMux);
+  ledcPending[displayNum].valid = false;          // Newer than anything queued
+  pulseStats[displayNum].reprograms++;            // The ISR counts under this mux too
+  portEXIT_CRITICAL(&ledcPendingMux);
+  ledc_mode_t mode = ledcModeOf(displayNum);
+  ledc_timer_set(mode, (ledc_timer_t)LEDC_TIMERS[displayNum], plan.divQ8, plan.bits, LEDC_APB_CLK);
+  ledc_set_duty(mode, ledcChanOf(displayNum), ledcPlanDuty(plan, dutyPct));
+  ledc_update_duty(mode, ledcChanOf(displayNum));
+  return true;
+}
+
+// Task-side reprogram count; shares the mux with the overflow ISR's count
+static void countReprogram(int displayNum) {
+  portENTER_CRITICAL(&ledcPendingMux);
+  pulseStats[displayNum].reprograms++;
+  portEXIT_CRITICAL(&ledcPendingMux);
+}
+
+// Stop output at the next period boundary and drop anything queued
+static void ledcStopPulse(int displayNum) {
+  portENTER_CRITICAL(&ledcPendingMux);
+  ledcPending[displayNum].valid = false;
+  portEXIT_CRITICAL(&ledcPendingMux);
+  ledcWrite(LEDC_CHANNELS[displayNum], 0);
+}
+
+// DDS tick: every output's phase accumulator, then one GPIO write per edge set
+static void IRAM_ATTR ddsIsr() {
+  uint32_t c0 = cpu_hal_get_cycle_count();
+  uint64_t setM, clrM;
+  ddsTick(ddsEngine, setM, clrM);
+  if ((uint32_t)setM) GPIO.out_w1ts = (uint32_t)setM;
+  if (setM >> 32) GPIO.out1_w1ts.val = (uint32_t)(setM >> 32);
+  if ((uint32_t)clrM) GPIO.out_w1tc = (uint32_t)clrM;
+  if (clrM >> 32) GPIO.out1_w1tc.val = (uint32_t)(clrM >> 32);
+  uint32_t c = cpu_hal_get_cycle_count() - c0;
+  ddsStats.ticks++;
+  ddsStats.lastCycles = c;
+  if (c > ddsStats.maxCycles) ddsStats.maxCycles = c;
+  ddsStats.avgCycles16 += c - (ddsStats.avgCycles16 >> 4);
+}
+
+static void ddsTimerRun(bool run) {
+  if (!ddsTimer) {
+    if (!run) return;
+    ddsTimer = timerBegin(DDS_HW_TIMER, 80, true);          // 1 MHz
+    timerAttachInterrupt(ddsTimer, &ddsIsr, true);
+    timerAlarmWrite(ddsTimer, 1000000 / DDS_TICK_HZ, true);
+  }
+  if (run) timerAlarmEnable(ddsTimer);
+  else timerAlarmDisable(ddsTimer);
+}
+
 void startDisplay(int displayNum) {
   if (displayNum < 0 || displayNum >= 3) return;
+  if (!ledcActive[displayNum] && displays[displayNum].enabled) {
+    resolveDisplayDriver(displayNum);
+    startedPin[displayNum] = displays[displayNum].pulsePin;
+  }
   
+  if (!ledcActive[displayNum] && displays[displayNum].enabled && pulseMode == PULSE_MODE_DDS) {
+    // No LEDC at all: the pin is driven from the DDS interrupt
+    pinMode(displays[displayNum].pulsePin, OUTPUT);
+    digitalWrite(displays[displayNum].pulsePin, LOW);
+    ddsAttach(ddsEngine, displayNum, displays[displayNum].pulsePin);
+    ddsTimerRun(true);
+    startedMode[displayNum] = PULSE_MODE_DDS;
+    ledcActive[displayNum] = true;
+    lastFreq[displayNum] = 0;
+    LOG_INFO("Display %d DDS started, pin=%d", displayNum, displays[displayNum].pulsePin);
+    updateDisplayPulse(displayNum);
+    return;
+  }
+
   if (!ledcActive[displayNum] && displays[displayNum].enabled) {
     // Setup LEDC channel with separate timer
     ledcSetup(LEDC_CHANNELS[displayNum], LEDC_BASE_FREQ, LEDC_TIMER_RESOLUTION);
     ledcAttachPin(displays[displayNum].pulsePin, LEDC_CHANNELS[displayNum]);
+    if (ledcDirect()) {
+      // Arduino pairs channels 0/1 on one timer; give each display its own
+      ledc_timer_config_t tc = {};
+      tc.speed_mode = ledcModeOf(displayNum);
+      tc.duty_resolution = (ledc_timer_bit_t)LEDC_TIMER_RESOLUTION;
+      tc.timer_num = (ledc_timer_t)LEDC_TIMERS[displayNum];
+      tc.freq_hz = LEDC_BASE_FREQ;
+      tc.clk_cfg = LEDC_USE_APB_CLK;
+      ledc_timer_config(&tc);
+      ledc_bind_channel_timer(ledcModeOf(displayNum), ledcChanOf(displayNum), tc.timer_num);
+      if (!ledcIsrInstalled) {
+        ledcIsrInstalled = ledc_isr_register(ledcOvfIsr, nullptr, 0, nullptr) == ESP_OK;
+      }
+    }
+    startedMode[displayNum] = pulseMode;
     ledcActive[displayNum] = true;
     lastFreq[displayNum] = 0; // Reset frequency tracking
     
-    Serial.printf("Display %d LEDC started, timer=%d\n", displayNum, LEDC_TIMERS[displayNum]);
+    LOG_INFO("Display %d LEDC started, timer=%d", displayNum, LEDC_TIMERS[displayNum]);
     updateDisplayPulse(displayNum);
   }
 }
@@ -346,133 +714,94 @@ void startDisplay(int displayNum) {
 void stopDisplay(int displayNum) {
   if (displayNum < 0 || displayNum >= 3) return;
   
+  if (ledcActive[displayNum] && startedMode[displayNum] == PULSE_MODE_DDS) {
+    ddsDetach(ddsEngine, displayNum);
+    ledcActive[displayNum] = false;
+    lastFreq[displayNum] = 0;
+    pinMode(startedPin[displayNum], INPUT);
+    bool any = false;
+    for (int i = 0; i < DDS_MAX_OUTPUTS; i++) any |= ddsEngine.out[i].pinMask != 0;
+    if (!any) ddsTimerRun(false);
+    LOG_INFO("Display %d DDS stopped", displayNum);
+    return;
+  }
+
   if (ledcActive[displayNum]) {
-    ledcWrite(LEDC_CHANNELS[displayNum], 0); // Stop PWM
-    ledcDetachPin(displays[displayNum].pulsePin);
+    ledcStopPulse(displayNum); // Stop PWM
+    ledcDetachPin(startedPin[displayNum]);
     ledcActive[displayNum] = false;
     lastFreq[displayNum] = 0; // Reset frequency tracking
-    pinMode(displays[displayNum].pulsePin, INPUT);
-    Serial.printf("Display %d LEDC stopped\n", displayNum);
+    pinMode(startedPin[displayNum], INPUT);
+    LOG_INFO("Display %d LEDC stopped", displayNum);
   }
 }
 
 void updateDisplayPulse(int displayNum) {
   if (displayNum < 0 || displayNum >= 3 || !ledcActive[displayNum]) return;
-  
-  DisplayConfig &disp = displays[displayNum];
-  
-  // Read speed with mutex protection
-  float currentSpeed;
-  xSemaphoreTake(dataMutex, portMAX_DELAY);
-  currentSpeed = sumlog_speed_kn;
-  xSemaphoreGive(dataMutex);
-  
-  // Check for data timeout (4 seconds without NMEA data)
-  uint32_t dataAge = millis() - lastNmeaDataMs;
-  if (dataAge > 4000) {
-    currentSpeed = 0.0f;
-    if (lastFreq[displayNum] != 0) {
-      Serial.printf("Data timeout! Last NMEA data %u ms ago - zeroing speed\n", dataAge);
-    }
+  StageTimer timer(stageHist[STAGE_PULSE]);
+  
+  // Zero while the speed watchdog has fired
+  float currentSpeed = (dataStale.load() & STALE_SPEED) ? 0.0f : windState.read().speedKn;
+  
+  const PulseDriver& drv = pulseDrivers[displayNum];
+  uint32_t mHz = drv.freqMilliHz(drv, currentSpeed);
+  if (pulseMode == PULSE_MODE_INT) mHz = pulseRoundHz(mHz) * 1000;
+  if (mHz == lastFreq[displayNum]) return;  // Only touch LEDC on change
+  bool dds = startedMode[displayNum] == PULSE_MODE_DDS;
+  // DDS changes cost nothing and are phase-continuous; no band needed
+  if (!pulseOutsideBand(lastFreq[displayNum], mHz, dds ? 0 : pulseHystPermille)) {
+    pulseStats[displayNum].hystSkips++;
+    return;
   }
-  
-  if (strcmp(disp.type, "sumlog") == 0) {
-    // Stop immediately if raw speed is 0
-    if (currentSpeed < 0.01f && lastFreq[displayNum] != 0) {
-      ledcWrite(LEDC_CHANNELS[displayNum], 0);
-      lastFreq[displayNum] = 0;
-      Serial.printf("Display %d stopped (speed=0)\n", displayNum);
-      return;
-    }
-    
-    // Sumlog pulse calculation
-    float freq = currentSpeed * disp.sumlogK;
-    if (freq > (float)disp.sumlogFmax) freq = (float)disp.sumlogFmax;
-    
-    if (freq < 0.01f) {
-      // Stop PWM when frequency too low
-      if (lastFreq[displayNum] != 0) {
-        ledcWrite(LEDC_CHANNELS[displayNum], 0);
-        lastFreq[displayNum] = 0;
-        Serial.printf("Display %d stopped (freq too low)\n", displayNum);
-      }
-    } else {
-      // Round frequency to reduce jitter
-      uint32_t freqInt = (uint32_t)(freq + 0.5f);
-      
-      // Only update if frequency actually changed
-      if (freqInt != lastFreq[displayNum]) {
-        // Vältä 0Hz joka aiheuttaa LEDC virheen
-        if (freqInt == 0) {
-          ledcWrite(LEDC_CHANNELS[displayNum], 0);
-          lastFreq[displayNum] = 0;
-          Serial.printf("Display %d stopped (0Hz avoided)\n", displayNum);
-        } else {
-          // Calculate duty cycle (0-1023 for 10-bit resolution)
-          uint32_t duty = (uint32_t)((1023 * disp.pulseDuty) / 100);
-          
-          // Set frequency and duty cycle
-          ledcChangeFrequency(LEDC_CHANNELS[displayNum], freqInt, LEDC_TIMER_RESOLUTION);
-          ledcWrite(LEDC_CHANNELS[displayNum], duty);
-          
-          lastFreq[displayNum] = freqInt;
-          Serial.printf("Display %d freq=%uHz (speed=%.1f kn)\n", displayNum, freqInt, currentSpeed);
-        }
-      }
-    }
-  } else if (strcmp(disp.type, "logicwind") == 0) {
-    // Stop immediately if raw speed is 0
-    if (currentSpeed < 0.01f && lastFreq[displayNum] != 0) {
-      ledcWrite(LEDC_CHANNELS[displayNum], 0);
-      lastFreq[displayNum] = 0;
-      Serial.printf("Display %d Logic Wind stopped (speed=0)\n", displayNum);
-      return;
-    }
-    
-    // Logic Wind pulse calculation
-    float freq = currentSpeed * disp.sumlogK;
-    if (freq > (float)disp.sumlogFmax) freq = (float)disp.sumlogFmax;
-    
-    if (freq < 0.01f) {
-      // Stop PWM when frequency too low
-      if (lastFreq[displayNum] != 0) {
-        ledcWrite(LEDC_CHANNELS[displayNum], 0);
-        lastFreq[displayNum] = 0;
-        Serial.printf("Display %d stopped (freq too low)\n", displayNum);
-      }
-    } else {
-      // Round frequency to reduce jitter
-      uint32_t freqInt = (uint32_t)(freq + 0.5f);
-      
-      // Only update if frequency actually changed
-      if (freqInt != lastFreq[displayNum]) {
-        // Vältä 0Hz joka aiheuttaa LEDC virheen
-        if (freqInt == 0) {
-          ledcWrite(LEDC_CHANNELS[displayNum], 0);
-          lastFreq[displayNum] = 0;
-          Serial.printf("Display %d Logic Wind stopped (0Hz avoided)\n", displayNum);
-        } else {
-          // Calculate duty cycle (0-1023 for 10-bit resolution)
-          uint32_t duty = (uint32_t)((1023 * disp.pulseDuty) / 100);
-          
-          // Set frequency and duty cycle
-          ledcChangeFrequency(LEDC_CHANNELS[displayNum], freqInt, LEDC_TIMER_RESOLUTION);
-          ledcWrite(LEDC_CHANNELS[displayNum], duty);
-          
-          lastFreq[displayNum] = freqInt;
-          Serial.printf("Display %d Logic Wind freq=%uHz (speed=%.1f kn)\n", displayNum, freqInt, currentSpeed);
-        }
-      }
-    }
+
+  bool running;
+  if (dds) {
+    ddsSet(ddsEngine, displayNum, mHz, drv.dutyPct);   // 0 mHz = off
+    running = mHz != 0;
+  } else if (mHz == 0) {
+    running = false;  // Vältä 0Hz joka aiheuttaa LEDC virheen
+  } else if (ledcDirect()) {
+    // From a stopped output there is no pulse to finish
+    bool atEnd = pulseUpdateMode == PULSE_UPDATE_PERIOD_END && lastFreq[displayNum] != 0;
+    running = ledcApplyMilliHz(displayNum, mHz, drv.dutyPct, atEnd);
   } else {
-    // Unknown type - no pulse, stop PWM
-    if (lastFreq[displayNum] != 0) {
-      ledcWrite(LEDC_CHANNELS[displayNum], 0);
-      lastFreq[displayNum] = 0;
-    }
+    ledcChangeFrequency(LEDC_CHANNELS[displayNum], mHz / 1000, LEDC_TIMER_RESOLUTION);
+    ledcWrite(LEDC_CHANNELS[displayNum], drv.dutyCount);
+    countReprogram(displayNum);
+    running = true;
+  }
+  if (!running && !dds) ledcStopPulse(displayNum);
+  // Below the LEDC plan range nothing runs: report 0 and start afresh next time
+  lastFreq[displayNum] = running ? mHz : 0;
+  if (running) {
+    LOG_DEBUG("Display %d %s %u mHz (speed=%.1f kn)", displayNum, drv.label, mHz, currentSpeed);
+  } else {
+    LOG_DEBUG("Display %d %s stopped (speed=%.1f kn)", displayNum, drv.label, currentSpeed);
   }
 }
 
+// Ask the output task to restart a display with its current config (enable,
+// disable, type/K/fmax/duty/pin or pulse mode changed). Safe from any task.
+void requestDisplayRestart(int displayNum) {
+  if (displayNum < 0 || displayNum >= 3) return;
+  displayRestart.fetch_or(1u << displayNum);
+}
+
+// Ask the output task to re-init a display's DAC after its address changed
+void requestDacInit(int displayNum) {
+  if (displayNum < 0 || displayNum >= 3) return;
+  displayRestart.fetch_or(1u << (RESTART_DAC_SHIFT + displayNum));
+}
+
+// Resolve the pulse driver from the display's type/K/fmax/duty; done by
+// startDisplay() so it only changes under the output task
+void resolveDisplayDriver(int displayNum) {
+  if (displayNum < 0 || displayNum >= 3) return;
+  const DisplayConfig& d = displays[displayNum];
+  pulseDriverResolve(pulseDrivers[displayNum], d.type, d.sumlogK, d.sumlogFmax,
+                     d.pulseDuty, LEDC_TIMER_RESOLUTION);
+}
+
 // Update all active displays (immediate response for accurate measurement)
 void updateAllDisplayPulses() {
   for (int i = 0; i < 3; i++) {
@@ -482,147 +811,233 @@ void updateAllDisplayPulses() {
   }
 }
 
+// Per-second reprogram rate; every output tick so it drops to 0 when idle
+static void updatePulseRates(uint32_t now) {
+  for (int i = 0; i < 3; i++) {
+    PulseStats& ps = pulseStats[i];
+    if (now - ps.rateStartMs >= 1000) {
+      uint32_t n = ps.reprograms;
+      ps.reprogramsPerSec = (n - ps.lastReprograms) * 1000 / (now - ps.rateStartMs);
+      ps.lastReprograms = n;
+      ps.rateStartMs = now;
+    }
+  }
+}
+
 /* ========= NMEA-parsinta ========= */
-bool nmeaChecksumOK(const char* s){
-  const char* star = strrchr(s, '*');
-  if(!star) return true;
-  uint8_t cs=0; const char* p = s+1;
-  while(p && *p && p<star){ cs ^= (uint8_t)(*p++); }
-  if(*(star+1)==0 || *(star+2)==0) return true;
-  char hex[3]={star[1], star[2], 0};
-  uint8_t want = (uint8_t)strtoul(hex, nullptr, 16);
-  return cs==want;
-}
-int splitCSV(char* line, char* fields[], int maxf){
-  int n=0; for(char* p=line; *p && n<maxf; ){
-    fields[n++]=p; char* c=strchr(p, ','); if(!c) break; *c=0; p=c+1;
-  } return n;
-}
-bool hasFormatter(const char* s, const char* fmt3){
-  const char* p=s; if(*p=='$') p++;
-  if(strlen(p)<5) return false;
-  // Check for formatter - can be at position 0-2 or 2-4 (for talkers like II, WI, etc)
-  // Standard: $IIMWV (pos 2-4) or Yachta: $WIMWV (pos 3-5)
-  if (p[2]==fmt3[0] && p[3]==fmt3[1] && p[4]==fmt3[2]) return true;
-  if (strlen(p)>=6 && p[3]==fmt3[0] && p[4]==fmt3[1] && p[5]==fmt3[2]) return true;
-  return false;
-}
-
-bool parseMWV(char* line){
-  char* f[12]; int n = splitCSV(line, f, 12);
-  if(n<3) return false;
-  if(!hasFormatter(line,"MWV")) return false;
-  if(!nmeaChecksumOK(line)) return false;
-  float ang = atof(f[1]); char ref = toupper((unsigned char)f[2][0]);
-  if(ref!='R' && ref!='T') return false;
-  if(!(ang>=0 && ang<=360)) return false;
-  
-  int newAngle = wrap360((int)lroundf(ang));
-  float newSpeed = 0.0f;
-  bool hasSpeed = false;
-  
-  if(n>=4) {
-    float spd = atof(f[3]);
-    if(spd>=0 && spd<200) {
-      newSpeed = spd;
-      hasSpeed = true;
+// Parsing itself lives in nmea_parser.cpp; this applies a parsed sample to shared state
+void applyWindSample(const WindSample& sample){
+  // Publish to readers; never waits for them
+  windState.update([&](WindState& w) {
+    w.angleDeg = sample.angleDeg;
+    w.angleCdeg = sample.angleCdeg;
+    if (sample.hasSpeed) {
+      w.speedKn = sample.speedKn;
     }
+    w.kind = sample.kind;
+  });
+}
+
+// Handle one validated line from a transport framer: parse and queue
+void processNmeaLine(const char* line, size_t len, WindSource source){
+  rawLine.update([&](RawLine& r) {
+    size_t n = len < sizeof(r.text) - 1 ? len : sizeof(r.text) - 1;
+    memcpy(r.text, line, n);
+    r.text[n] = '\0';
+  });
+  lastNmeaDataMs = millis();
+
+  QueuedWindSample q;
+  NmeaParseResult res;
+  {
+    StageTimer timer(stageHist[STAGE_PARSE]);
+    res = nmeaParseFramed(line, len, q.wind);   // Framer already checked it
   }
-  
-  // Update shared data with mutex protection
-  xSemaphoreTake(dataMutex, portMAX_DELAY);
-  angleDeg = newAngle;
-  if (hasSpeed) {
-    sumlog_speed_kn = newSpeed;
+  noteWakeToParse();
+  nmeaMetrics.results[res]++;
+  if (res == NMEA_OK) {
+    nmeaMetrics.sentences[q.wind.kind]++;
+    // Only wind that is actually used keeps the outputs alive
+    feedDataWatchdog(STALE_ANGLE | (q.wind.hasSpeed ? STALE_SPEED : 0));
+    q.source = source;
+    q.timestampMs = lastNmeaDataMs;
+    windQueue.push(q);   // Full queue: counted in windQueue.dropped
   }
-  snprintf(lastSentenceType, sizeof(lastSentenceType), "MWV(%c)", ref);
-  xSemaphoreGive(dataMutex);
-  
-  updateAllDisplayPulses();
-  
-  if(ref=='R') hasMwvR = true;
-  else if(ref=='T') hasMwvT = true;
-  return true;
 }
-bool parseVWR(char* line){
-  char* f[12]; int n = splitCSV(line, f, 12);
-  if(n<3) return false;
-  if(!hasFormatter(line,"VWR")) return false;
-  if(!nmeaChecksumOK(line)) return false;
-  float ang = atof(f[1]); char side = toupper((unsigned char)f[2][0]);
-  if(!(ang>=0 && ang<=180)) return false;
-  int awa = (int)lroundf(ang);
-  int newAngle = (side=='L') ? wrap360(360-awa) : awa;
-  float newSpeed = 0.0f;
-  bool hasSpeed = false;
-  
-  if(n>=4) {
-    float spd = atof(f[3]);
-    if(spd>=0 && spd<200) {
-      newSpeed = spd;
-      hasSpeed = true;
-    }
+
+/* ========= Data watchdog ========= */
+// Runs in the esp_timer task; the output task reacts to the flag. A feed
+// on the NMEA core can land between the check and the set, so look again
+// after setting: the feed writes windFreshMs before it clears the bit.
+static bool fedSinceTimeout(uint32_t bit) {
+  uint32_t fresh = windFreshMs[bit == STALE_ANGLE ? 0 : 1];
+  return millis() - fresh + 10 < DATA_TIMEOUT_MS;
+}
+
+static void staleTimerCb(void* arg) {
+  uint32_t bit = (uint32_t)(uintptr_t)arg;
+  if (fedSinceTimeout(bit)) return;   // Fed while we fired
+  dataStale.fetch_or(bit);
+  if (fedSinceTimeout(bit)) dataStale.fetch_and(~bit);
+}
+
+void startDataWatchdog() {
+  const uint32_t bits[2] = { STALE_ANGLE, STALE_SPEED };
+  const char* names[2] = { "angle_wd", "speed_wd" };
+  for (int q = 0; q < 2; q++) {
+    esp_timer_create_args_t args = {};
+    args.callback = staleTimerCb;
+    args.arg = (void*)(uintptr_t)bits[q];
+    args.dispatch_method = ESP_TIMER_TASK;
+    args.name = names[q];
+    esp_timer_create(&args, &staleTimers[q]);
   }
-  
-  // Update shared data with mutex protection
-  xSemaphoreTake(dataMutex, portMAX_DELAY);
-  angleDeg = newAngle;
-  if (hasSpeed) {
-    sumlog_speed_kn = newSpeed;
+}
+
+// Mark angle and/or speed fresh and push their timeout out again
+void feedDataWatchdog(uint32_t bits) {
+  uint32_t now = millis();
+  for (int q = 0; q < 2; q++) {
+    uint32_t bit = q == 0 ? STALE_ANGLE : STALE_SPEED;
+    if (!(bits & bit) || !staleTimers[q]) continue;
+    windFreshMs[q] = now;
+    dataStale.fetch_and(~bit);
+    esp_timer_stop(staleTimers[q]);   // Not running is fine
+    esp_timer_start_once(staleTimers[q], (uint64_t)DATA_TIMEOUT_MS * 1000);
   }
-  strncpy(lastSentenceType, "VWR", sizeof(lastSentenceType) - 1);
-  lastSentenceType[sizeof(lastSentenceType) - 1] = '\0';
-  xSemaphoreGive(dataMutex);
-  
-  updateAllDisplayPulses();
-  hasVwr = true;
-  return true;
 }
-bool parseVWT(char* line){
-  char* f[12]; int n = splitCSV(line, f, 12);
-  if(n<3) return false;
-  if(!hasFormatter(line,"VWT")) return false;
-  if(!nmeaChecksumOK(line)) return false;
-  float ang = atof(f[1]); char side = toupper((unsigned char)f[2][0]);
-  if(!(ang>=0 && ang<=180)) return false;
-  int awa = (int)lroundf(ang);
-  int newAngle = (side=='L') ? wrap360(360-awa) : awa;
-  float newSpeed = 0.0f;
-  bool hasSpeed = false;
-  
-  if(n>=4) {
-    float spd = atof(f[3]);
-    if(spd>=0 && spd<200) {
-      newSpeed = spd;
-      hasSpeed = true;
-    }
+
+// Apply every queued sample in arrival order; true if there were any
+bool drainWindQueue(){
+  QueuedWindSample q;
+  bool any = false;
+  while (windQueue.pop(q)) {
+    applyWindSample(q.wind);
+    any = true;
   }
-  
-  // Update shared data with mutex protection
-  xSemaphoreTake(dataMutex, portMAX_DELAY);
-  angleDeg = newAngle;
-  if (hasSpeed) {
-    sumlog_speed_kn = newSpeed;
+  return any;
+}
+
+// Null vector instead of a frozen direction while there is no angle
+static void parkNeedle() {
+  for (int i = 0; i < 3; i++) {
+    if (displays[i].enabled && dacReady[i]) displayDacs[i].write(VCEN, VCEN);
+  }
+}
+
+// FreeRTOS output task: at a fixed rate, drive DAC and LEDC from the latest
+// state only, however many samples arrived since the last tick. The needle
+// moves toward the latest angle at most slewMaxDps per second.
+void outputTaskFunc(void *pvParameters) {
+  LOG_INFO("Output task started, %u Hz", outputRateHz);
+  TickType_t lastWake = xTaskGetTickCount();
+  uint32_t lastVersion = 0;
+  uint32_t lastEpoch = 0;
+  uint32_t lastPulseMs = 0;
+  bool pulseDirty = true;
+  uint32_t lastStale = dataStale.load();   // Stale from boot is not a transition
+  if (lastStale & STALE_ANGLE) parkNeedle();  // ...but nothing has arrived to show
+  int32_t targetCdeg = 0;
+  int32_t needleCdeg = NEEDLE_UNSET;
+  while(1) {
+    uint32_t periodMs = 1000 / outputRateHz;
+    if (periodMs == 0) periodMs = 1;
+
+    drainWindQueue();
+
+    // Restarts asked for by web handlers; this task owns the pulse outputs
+    // and the DACs
+    bool force = false;
+    uint32_t restart = displayRestart.exchange(0);
+    for (int i = 0; i < 3; i++) {
+      if (restart & (1u << (RESTART_DAC_SHIFT + i))) {
+        initDisplayDac(i, 1);
+        force = true;   // Drive the new DAC right away
+      }
+      if (!(restart & (1u << i))) continue;
+      stopDisplay(i);
+      startDisplay(i);   // Only if enabled; resolves the driver and sets the pulse
+    }
+
+    // Direction: new target on any state change (new sample, /goto); a
+    // config change (/trim, display save) re-applies the same target
+    uint32_t v = windState.version();
+    if (v != lastVersion) {
+      lastVersion = v;
+      targetCdeg = windState.read().angleCdeg;
+      force = true;
+      pulseDirty = true;
+    }
+    uint32_t epoch = configEpoch.load();
+    if (epoch != lastEpoch) {
+      lastEpoch = epoch;
+      force = true;
+      pulseDirty = true;
+    }
+
+    // Watchdog transitions only; nothing is recomputed while data is steady
+    uint32_t stale = dataStale.load();
+    if (stale != lastStale) {
+      uint32_t fired = stale & ~lastStale;
+      if (fired & STALE_SPEED) LOG_WARN("No speed data for %u ms - zeroing pulses", DATA_TIMEOUT_MS);
+      if (fired & STALE_ANGLE) {
+        LOG_WARN("No angle data for %u ms - parking needle", DATA_TIMEOUT_MS);
+        parkNeedle();
+        needleCdeg = NEEDLE_UNSET;   // Jump, not slew, once data is back
+      }
+      lastStale = stale;
+      pulseDirty = true;
+    }
+
+    // Parked while the angle watchdog has fired
+    if (!(stale & STALE_ANGLE)) {
+      int32_t next = needleStepCdeg(needleCdeg, targetCdeg, slewStepCdeg(slewMaxDps, 1000 / periodMs));
+      if (next != needleCdeg || force) {
+        needleCdeg = next;
+        // All DAC displays in one batch; each applies its own offset and
+        // unchanged channels cost no bus time
+        for (int i = 0; i < 3; i++) {
+          if (displays[i].enabled) setOutputsCdeg(i, needleCdeg);
+        }
+        int deg = wrap360((needleCdeg + 50) / 100);
+        if (deg != lastAngleSent) {
+          LOG_DEBUG("Direction: %d°", deg);
+          lastAngleSent = deg;
+        }
+      }
+    }
+
+    // Speed pulses only after a change, at most every PULSE_UPDATE_MS
+    uint32_t now = millis();
+    if (pulseDirty && now - lastPulseMs >= PULSE_UPDATE_MS) {
+      lastPulseMs = now;
+      pulseDirty = false;
+      updateAllDisplayPulses();
+    }
+    updatePulseRates(now);
+
+    vTaskDelayUntil(&lastWake, pdMS_TO_TICKS(periodMs));
   }
-  strncpy(lastSentenceType, "VWT", sizeof(lastSentenceType) - 1);
-  lastSentenceType[sizeof(lastSentenceType) - 1] = '\0';
-  xSemaphoreGive(dataMutex);
-  
-  updateAllDisplayPulses();
-  hasVwt = true;
-  return true;
 }
-bool parseNMEALine(char* line){
-  if(strlen(line)<6 || line[0]!='$') return false;
-  static char tmp[256];
-  size_t L = min(strlen(line), sizeof(tmp)-1);
-  memcpy(tmp, line, L); tmp[L]=0;
-  if(hasFormatter(tmp,"MWV") && parseMWV(tmp)) return true;
-  memcpy(tmp,line,L); tmp[L]=0;
-  if(hasFormatter(tmp,"VWR") && parseVWR(tmp)) return true;
-  memcpy(tmp,line,L); tmp[L]=0;
-  if(hasFormatter(tmp,"VWT") && parseVWT(tmp)) return true;
-  return false;
+
+// FreeRTOS logger task: the only place hot-path log records touch the UART
+void loggerTaskFunc(void *pvParameters) {
+  char line[160];
+  uint32_t reportedDrops = 0;
+  while(1) {
+    LogRecord rec;
+    while (logRing.pop(rec)) {
+      int n = snprintf(line, sizeof(line), "[%lu] %c ", (unsigned long)rec.ms, logLevelChar(rec.level));
+      logFormat(rec, line + n, sizeof(line) - n);
+      Serial.println(line);
+    }
+    uint32_t drops = logRing.dropped.load();
+    if (drops != reportedDrops) {
+      Serial.printf("[log] %u records dropped\n", drops - reportedDrops);
+      reportedDrops = drops;
+    }
+    vTaskDelay(pdMS_TO_TICKS(20));
+  }
 }
 
 /* ========= UDP/TCP BIND & POLL ========= */
@@ -632,68 +1047,75 @@ void ensureTCPConnected(WiFiClient& client){
   if (now < lastTcpAttempt) return;
   lastTcpAttempt = now + 3000;
   
-  Serial.printf("TCP connect to %s:%u...\n", nmeaHost, nmeaPort);
+  LOG_INFO("TCP connect to %s:%u...", nmeaHost, nmeaPort);
   client.stop();
   client.setTimeout(1000);
   
+  nmeaMetrics.tcpConnectAttempts++;
   if(client.connect(nmeaHost, nmeaPort)) {
-    Serial.println("TCP connected! Setting non-blocking mode...");
+    LOG_INFO("TCP connected! Setting non-blocking mode...");
     client.setTimeout(0);
+    tcpFramer.reset();  // Drop any half line from the previous session
+    tcpStats.backlogSinceMs = 0;
+    nmeaMetrics.tcpSessions++;
+    nmeaMetrics.tcpSessionStartMs = millis();
   } else {
-    Serial.println("TCP connect failed");
+    nmeaMetrics.tcpConnectFailures++;
+    LOG_WARN("TCP connect failed");
   }
 }
 
 
 void pollTCP(WiFiClient& client){
   if(!client.connected()) return;
+  StageTimer timer(stageHist[STAGE_POLL_TCP]);
 
-  // Reset sentence flags every 5 seconds
-  if(millis() - lastFlagReset > 5000) {
-    hasMwvR = false;
-    hasMwvT = false;
-    hasVwr = false;
-    hasVwt = false;
-    lastFlagReset = millis();
-  }
-
-  // Non-blocking: read only one chunk, not all available
-  if(client.available()) {
-    // Read one chunk
-    size_t n = client.readBytes(netBuf, sizeof(netBuf)-1);
-    if(n > 0) {
-      netBuf[n] = 0;
-      
-      // Process chunk: accumulate into line buffer
-      for(size_t i = 0; i < n; i++) {
-        char c = netBuf[i];
-        
-        if(c == '\r' || c == '\n') {
-          // End of line found
-          if(nmeaLineBufLen > 0) {
-            nmeaLineBuf[nmeaLineBufLen] = 0;
-            
-            xSemaphoreTake(dataMutex, portMAX_DELAY);
-            strncpy(lastSentenceRaw, nmeaLineBuf, sizeof(lastSentenceRaw) - 1);
-            lastSentenceRaw[sizeof(lastSentenceRaw) - 1] = '\0';
-            xSemaphoreGive(dataMutex);
-            lastNmeaDataMs = millis();
-            if(parseNMEALine(nmeaLineBuf)) {
-              setOutputsDeg(0, angleDeg);
-            }
-            nmeaLineBufLen = 0;
-          }
-        } else if(nmeaLineBufLen < sizeof(nmeaLineBuf)-1) {
-          // Accumulate character
-          nmeaLineBuf[nmeaLineBufLen++] = c;
-        }
+  // Non-blocking: drain the socket, at most tcpReadBudget bytes per cycle
+  int avail = client.available();
+  if(avail <= 0) {
+    tcpStats.backlog = 0;
+    return;
+  }
+  uint32_t now = millis();
+  if(tcpStats.backlogSinceMs == 0) tcpStats.backlogSinceMs = now ? now : 1;
+
+  size_t cycleBytes = 0;
+  while(avail > 0 && cycleBytes < tcpReadBudget) {
+    size_t want = sizeof(netBuf) - 1;
+    if(want > tcpReadBudget - cycleBytes) want = tcpReadBudget - cycleBytes;
+    int r = client.read((uint8_t*)netBuf, want);
+    if(r <= 0) break;
+    size_t n = (size_t)r;
+    netBuf[n] = 0;
+    cycleBytes += n;
+    
+    // Process chunk: framer validates as bytes arrive
+    for(size_t i = 0; i < n; i++) {
+      if(tcpFramer.push(netBuf[i])) {
+        processNmeaLine(tcpFramer.line(), tcpFramer.length(), WIND_SRC_TCP);
       }
     }
+    avail = client.available();
+  }
+
+  // Backlog bookkeeping: what is still queued in the socket after this cycle
+  tcpStats.cycleBytes = cycleBytes;
+  if(cycleBytes > tcpStats.maxCycleBytes) tcpStats.maxCycleBytes = cycleBytes;
+  tcpStats.backlog = avail > 0 ? (uint32_t)avail : 0;
+  if(tcpStats.backlog > tcpStats.maxBacklog) tcpStats.maxBacklog = tcpStats.backlog;
+  if(tcpStats.backlog > 0) {
+    tcpStats.budgetHits++;
+  } else {
+    // Drained: the burst waited at most this long in the socket
+    uint32_t delay = millis() - tcpStats.backlogSinceMs;
+    tcpStats.lastDelayMs = delay;
+    if(delay > tcpStats.maxDelayMs) tcpStats.maxDelayMs = delay;
+    tcpStats.backlogSinceMs = 0;
   }
 }
 
 void bindTransport(){
-  Serial.printf("TCP stream: %s:%u\n", nmeaHost, nmeaPort);
+  LOG_INFO("TCP stream: %s:%u", nmeaHost, nmeaPort);
   lastTcpAttempt = 0;
 }
 
@@ -711,65 +1133,98 @@ void ensureUDPBound() {
   uint16_t udpPort = p.getUShort("p2_port", 10110);
   p.end();
   
-  Serial.printf("UDP bind to port %u...\n", udpPort);
+  LOG_INFO("UDP bind to port %u...", udpPort);
+  
+  if (udpSock >= 0) {
+    close(udpSock);
+    udpSock = -1;
+  }
+  int s = socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+  if (s >= 0) {
+    int yes = 1;
+    setsockopt(s, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+    struct sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(udpPort);
+    addr.sin_addr.s_addr = htonl(INADDR_ANY);
+    if (bind(s, (struct sockaddr*)&addr, sizeof(addr)) == 0) {
+      fcntl(s, F_SETFL, O_NONBLOCK);
+      udpSock = s;
+    } else {
+      close(s);
+    }
+  }
   
-  if (udpClient.begin(udpPort)) {
-    Serial.printf("UDP bound successfully on port %u\n", udpPort);
+  if (udpSock >= 0) {
+    LOG_INFO("UDP bound successfully on port %u", udpPort);
     udpConnected = true;
   } else {
-    Serial.printf("UDP bind failed on port %u\n", udpPort);
+    LOG_WARN("UDP bind failed on port %u", udpPort);
     udpConnected = false;
   }
 }
 
 void pollUDP() {
   if (!udpConnected) return;
-  
-  // Reset sentence flags every 5 seconds (same as TCP)
-  if (millis() - lastFlagReset > 5000) {
-    hasMwvR = false;
-    hasMwvT = false;
-    hasVwr = false;
-    hasVwt = false;
-    lastFlagReset = millis();
-  }
-  
-  // Check for incoming UDP packets
-  int packetSize = udpClient.parsePacket();
-  if (packetSize > 0) {
-    // Read UDP packet
-    size_t n = udpClient.read((uint8_t*)udpBuf, sizeof(udpBuf) - 1);
-    if (n > 0) {
-      udpBuf[n] = 0;
-      
-      // Process packet: accumulate into line buffer (same as TCP)
-      for (size_t i = 0; i < n; i++) {
-        char c = udpBuf[i];
-        
-        if (c == '\r' || c == '\n') {
-          // End of line found
-          if (nmeaLineBufLen > 0) {
-            nmeaLineBuf[nmeaLineBufLen] = 0;
-            
-            xSemaphoreTake(dataMutex, portMAX_DELAY);
-            strncpy(lastSentenceRaw, nmeaLineBuf, sizeof(lastSentenceRaw) - 1);
-            lastSentenceRaw[sizeof(lastSentenceRaw) - 1] = '\0';
-            int angle = angleDeg;
-            xSemaphoreGive(dataMutex);
-            
-            lastNmeaDataMs = millis();
-            if (parseNMEALine(nmeaLineBuf)) {
-              setOutputsDeg(0, angle);
-            }
-            nmeaLineBufLen = 0;
-          }
-        } else if (nmeaLineBufLen < sizeof(nmeaLineBuf) - 1) {
-          // Accumulate character
-          nmeaLineBuf[nmeaLineBufLen++] = c;
-        }
+  StageTimer timer(stageHist[STAGE_POLL_UDP]);
+  
+  // Non-blocking: drain pending datagrams, at most udpDrainBudget per cycle
+  uint32_t got = 0;
+  while (got < udpDrainBudget) {
+    int r = recv(udpSock, udpBuf, sizeof(udpBuf) - 1, 0);
+    if (r <= 0) break;  // EWOULDBLOCK: receive queue empty
+    got++;
+    size_t n = (size_t)r;
+    udpBuf[n] = 0;
+    
+    // Process packet: framer validates as bytes arrive (same as TCP)
+    uint32_t linesBefore = udpFramer.stats.lines;
+    for (size_t i = 0; i < n; i++) {
+      if (udpFramer.push(udpBuf[i])) {
+        processNmeaLine(udpFramer.line(), udpFramer.length(), WIND_SRC_UDP);
       }
     }
+    // Datagram boundary ends the line
+    if (udpFramer.endOfPacket()) {
+      processNmeaLine(udpFramer.line(), udpFramer.length(), WIND_SRC_UDP);
+    }
+    if (udpFramer.stats.lines != linesBefore) udpStats.processed++;
   }
+  udpStats.received += got;
+  udpBudgetHit = (got >= udpDrainBudget);
+  if (udpBudgetHit) udpStats.budgetHits++;
+  // lwIP silently drops datagrams once the socket's receive mailbox is
+  // full; a drain that finds it full means some were probably lost
+  if (got >= CONFIG_LWIP_UDP_RECVMBOX_SIZE) udpStats.queueFull++;
+}
+
+// Per-second UDP rates from the running totals
+void updateUdpRates() {
+  uint32_t now = millis();
+  if (now - udpStats.rateStartMs < 1000) return;
+  static UdpIngestStats prev = {};
+#if LWIP_STATS && UDP_STATS
+  udpStats.dropped = lwip_stats.udp.drop;
+#endif
+  udpStats.receivedPerSec  = udpStats.received  - prev.received;
+  udpStats.processedPerSec = udpStats.processed - prev.processed;
+  udpStats.queueFullPerSec = udpStats.queueFull - prev.queueFull;
+  udpStats.droppedPerSec   = udpStats.dropped   - prev.dropped;
+  prev = udpStats;
+  udpStats.rateStartMs = now;
+}
+
+// Per-type arrival rate over a 5 s window
+void updateSentenceRates() {
+  uint32_t now = millis();
+  uint32_t elapsed = now - nmeaMetrics.rateStartMs;
+  if (elapsed < 5000) return;
+  static uint32_t prev[NMEA_KIND_COUNT] = {};
+  for (int k = 0; k < NMEA_KIND_COUNT; k++) {
+    nmeaMetrics.rateHz[k] = (nmeaMetrics.sentences[k] - prev[k]) * 1000.0f / elapsed;
+    prev[k] = nmeaMetrics.sentences[k];
+  }
+  nmeaMetrics.rateStartMs = now;
 }
 
 /* ========= STA-yhteys ========= */
@@ -802,17 +1257,29 @@ void setup() {
   delay(500);
 
   // Initialize FreeRTOS synchronization primitives
-  dataMutex = xSemaphoreCreateMutex();
   wifiMutex = xSemaphoreCreateMutex();
   nvsMutex = xSemaphoreCreateMutex();
   pauseAckSemaphore = xSemaphoreCreateBinary();
   
-  if (!dataMutex || !wifiMutex || !nvsMutex || !pauseAckSemaphore) {
+  if (!wifiMutex || !nvsMutex || !pauseAckSemaphore) {
     Serial.println("FATAL: Failed to create mutexes!");
     while(1) delay(1000);
   }
   Serial.println("Mutexes initialized");
 
+  // Logger first so early records from the other tasks get printed
+  xTaskCreatePinnedToCore(
+    loggerTaskFunc,        // Task function
+    "Logger",              // Task name
+    3072,                  // Stack size (bytes)
+    NULL,                  // Parameters
+    tskIDLE_PRIORITY + 1,  // Priority (lowest useful)
+    &loggerTask,           // Task handle
+    0                      // Core 0
+  );
+
+  rawLine.update([](RawLine& r) { strcpy(r.text, "-"); });
+
   loadConfig();
 
   // Initialize WiFi FIRST to reduce power draw during DAC init
@@ -831,28 +1298,15 @@ void setup() {
   delay(200);  // Let WiFi stack stabilize
   
   // Now initialize DAC after WiFi is stable
-  Wire.begin(SDA_PIN, SCL_PIN, I2C_HZ);
+  Wire.begin(SDA_PIN, SCL_PIN, i2cHz);
   delay(100);  // Give I2C time to initialize
   
   // Try DAC init with timeout - don't get stuck forever if DAC missing
-  int dacTries = 0;
-  bool dacReady = false;
-  while (dac.begin() != 0 && dacTries < 5) {
-    Serial.println("GP8403 init error");
-    delay(200);
-    dacTries++;
-  }
-  
-  if (dacTries >= 5) {
-    Serial.println("GP8403 init FAILED - continuing without DAC");
-  } else {
-    dac.setDACOutRange(dac.eOutputRange10V);
-    dacReady = true;
-    Serial.println("GP8403 init OK");
-  }
-  
-  if (dacReady) {
-    setOutputsDeg(0, angleDeg); // TODO: käytä oikeaa displayNum:ia
+  buildDacTable();
+  for (int i = 0; i < 3; i++) {
+    if (initDisplayDac(i, 5)) {
+      setOutputsDeg(i, windState.read().angleDeg);
+    }
   }
 
   // Initialize enabled displays
@@ -869,6 +1323,9 @@ void setup() {
 
   setupWebUI(server);
   
+  // Timers must exist before the NMEA task can feed them
+  startDataWatchdog();
+
   // Create NMEA polling task on Core 1 BEFORE starting web server
   xTaskCreatePinnedToCore(
     nmeaPollTaskFunc,      // Task function
@@ -880,6 +1337,17 @@ void setup() {
     1                      // Core 1 (0=Core 0, 1=Core 1)
   );
   Serial.println("NMEA polling task created");
+
+  // Output task on Core 0 so LEDC/I2C writes stay off the parser's core
+  xTaskCreatePinnedToCore(
+    outputTaskFunc,        // Task function
+    "Output",              // Task name
+    4096,                  // Stack size (bytes)
+    NULL,                  // Parameters
+    2,                     // Priority (higher than loop)
+    &outputTask,           // Task handle
+    0                      // Core 0
+  );
   
   // Simple toggle endpoints for NMEA processing
   server.on("/unfreeze", HTTP_GET, [](){
@@ -902,14 +1370,9 @@ void setup() {
 void loop() {
   // Core 0: Dedicated to web server (NMEA polling now runs on Core 1)
   static uint32_t lastDebug = 0;
-  static uint32_t lastTimeoutCheck = 0;
   uint32_t now = millis();
   
-  // Check for data timeout every 100ms (ensures speed/direction zero when connection is lost)
-  if (now - lastTimeoutCheck > 100) {
-    lastTimeoutCheck = now;
-    updateAllDisplayPulses();
-  }
+  // Data timeout (speed zeroed when connection is lost) is handled by the output task
   
   // Heartbeat every 10 seconds
   if (now - lastDebug > 10000) {
@@ -0,0 +1,20 @@
+#pragma once
+// wind_queue.h - Parsed wind samples handed from the NMEA task to the output stage
+
+#include "nmea_parser.h"
+#include "spsc_ring.h"
+
+enum WindSource : uint8_t {
+  WIND_SRC_TCP = 0,   // Profile 1
+  WIND_SRC_UDP = 1    // Profile 2
+};
+
+struct QueuedWindSample {
+  WindSample wind;        // Angle, speed, reference (sentence kind)
+  WindSource source;
+  uint32_t timestampMs;   // millis() when the line was completed
+};
+
+#define WIND_QUEUE_LEN  32
+
+typedef SpscRing<QueuedWindSample, WIND_QUEUE_LEN> WindQueue;
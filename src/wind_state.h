@@ -0,0 +1,22 @@
+#pragma once
+// wind_state.h - Latest wind data shared between the NMEA task, outputs and web UI
+
+#include "nmea_parser.h"
+#include "seqlock.h"
+
+struct WindState {
+  int angleDeg;           // 0..359, starboard positive
+  int32_t angleCdeg;      // Same angle in centidegrees, not rounded
+  float speedKn;          // Last reported wind speed
+  NmeaWindKind kind;      // Sentence that produced angle/speed
+};
+
+typedef Seqlock<WindState> WindStateLock;
+
+// Last validated line, any sentence type. Kept apart from WindState so
+// non-wind traffic does not bump its version and wake the output task.
+struct RawLine {
+  char text[256];
+};
+
+typedef Seqlock<RawLine> RawLineLock;
@@ -0,0 +1,105 @@
+// Host check + benchmark for the DAC lookup table: pio test -e native -f test_native_dac_table
+//
+// The table must reproduce the float math setOutputsDeg used to run per
+// sentence bit-for-bit, for every degree and a few calibrations.
+
+#include <unity.h>
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include "dac_table.h"
+#include "nmea_parser.h"
+
+#define DEG_TO_RAD 0.017453292519943295769236907684886
+
+static const DacCal kCals[] = {
+  { 2000, 4000, 2000, 6000 },   // Firmware default
+  { 2000, 4000, 2500, 6000 },   // Amplitude clipped by vmin/vmax
+  { 1000, 5000, 1234, 9000 },
+};
+
+static int mvClamp(int mv, const DacCal& c){ if(mv<c.vmin) return c.vmin; if(mv>c.vmax) return c.vmax; return mv; }
+
+// Verbatim copy of the old setOutputsDeg math
+static void floatPath(int deg, int offset, const DacCal& cal, int& sin_mV, int& cos_mV) {
+  int adj = wrap360(deg + offset);
+  float r = adj * DEG_TO_RAD;
+  float s = sinf(r), c = cosf(r);
+  float amp = cal.vamp;
+  sin_mV = mvClamp(cal.vcen + (int)lroundf(amp * s), cal);
+  cos_mV = mvClamp(cal.vcen + (int)lroundf(amp * c), cal);
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_table_matches_float_math() {
+  DacPair table[DAC_TABLE_SIZE];
+  for (const DacCal& cal : kCals) {
+    dacTableBuild(table, cal);
+    for (int offset = -180; offset <= 180; offset += 45) {
+      for (int deg = 0; deg < 360; deg++) {
+        int s, c;
+        floatPath(deg, offset, cal, s, c);
+        DacPair p = dacTableLookup(table, wrap360(deg + offset) * 100);
+        TEST_ASSERT_EQUAL_INT(s, p.sin_mV);
+        TEST_ASSERT_EQUAL_INT(c, p.cos_mV);
+      }
+    }
+  }
+}
+
+// Sub-degree entries sit between their whole-degree neighbours
+void test_fine_steps_between_degrees() {
+  DacPair table[DAC_TABLE_SIZE];
+  dacTableBuild(table, kCals[0]);
+  DacPair a = dacTableLookup(table, 1000), m = dacTableLookup(table, 1050), b = dacTableLookup(table, 1100);
+  TEST_ASSERT_TRUE(m.sin_mV >= a.sin_mV && m.sin_mV <= b.sin_mV);
+  TEST_ASSERT_TRUE(m.cos_mV <= a.cos_mV && m.cos_mV >= b.cos_mV);
+  TEST_ASSERT_TRUE(m.sin_mV != a.sin_mV && m.sin_mV != b.sin_mV);
+  // 359.96 rounds to the 0.0 entry
+  DacPair z = dacTableLookup(table, 0), w = dacTableLookup(table, 35996);
+  TEST_ASSERT_EQUAL_INT(z.sin_mV, w.sin_mV);
+}
+
+static const size_t kIterations = 200000;
+
+void test_bench_float_vs_table() {
+  const DacCal& cal = kCals[0];
+  DacPair table[DAC_TABLE_SIZE];
+  dacTableBuild(table, cal);
+
+  volatile int sink = 0;
+  auto t0 = std::chrono::steady_clock::now();
+  for (size_t it = 0; it < kIterations; it++) {
+    for (int deg = 0; deg < 360; deg += 7) {
+      int s, c;
+      floatPath(deg, 15, cal, s, c);
+      sink += s + c;
+    }
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  for (size_t it = 0; it < kIterations; it++) {
+    for (int deg = 0; deg < 360; deg += 7) {
+      DacPair p = dacTableLookup(table, wrap360(deg + 15) * 100);
+      sink += p.sin_mV + p.cos_mV;
+    }
+  }
+  auto t2 = std::chrono::steady_clock::now();
+  (void)sink;
+
+  double n = (double)kIterations * ((360 + 6) / 7);
+  double floatNs = std::chrono::duration<double, std::nano>(t1 - t0).count() / n;
+  double tableNs = std::chrono::duration<double, std::nano>(t2 - t1).count() / n;
+  char msg[128];
+  snprintf(msg, sizeof(msg), "float math %7.1f ns/update   table %7.1f ns/update", floatNs, tableNs);
+  TEST_MESSAGE(msg);
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_table_matches_float_math);
+  RUN_TEST(test_fine_steps_between_degrees);
+  RUN_TEST(test_bench_float_vs_table);
+  return UNITY_END();
+}
@@ -0,0 +1,131 @@
+// Host simulation of the DDS pulse engine: pio test -e native -f test_native_dds_engine
+//
+// Runs ddsTick() tick by tick as the timer interrupt would and checks the
+// edge timing it produces: mean frequency, duty, period jitter (one tick at
+// most), phase continuity across a frequency change, and the cost per tick.
+
+#include <unity.h>
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "dds_engine.h"
+
+static DdsEngine eng;
+
+void setUp(void) { memset(&eng, 0, sizeof(eng)); }
+void tearDown(void) {}
+
+struct EdgeLog {
+  uint32_t rises, lastRise, highTicks;
+  uint32_t minPeriod, maxPeriod;
+};
+
+// Simulate `ticks` interrupts; pin of slot 0 is GPIO 12
+static void run(uint32_t ticks, EdgeLog& log, uint32_t t0 = 0) {
+  const uint64_t pin = 1ULL << 12;
+  for (uint32_t t = t0; t < t0 + ticks; t++) {
+    uint64_t s, c;
+    ddsTick(eng, s, c);
+    TEST_ASSERT_TRUE((s & c) == (0));
+    if (s & pin) {
+      if (log.rises) {
+        uint32_t p = t - log.lastRise;
+        if (p < log.minPeriod) log.minPeriod = p;
+        if (p > log.maxPeriod) log.maxPeriod = p;
+      }
+      log.rises++;
+      log.lastRise = t;
+    }
+    if (eng.level & pin) log.highTicks++;
+  }
+}
+
+static void test_frequency_and_duty(void) {
+  const uint32_t mHzs[] = { 100, 650, 1000, 12345, 50000, 150000 };
+  for (uint32_t mHz : mHzs) {
+    setUp();
+    ddsAttach(eng, 0, 12);
+    ddsSet(eng, 0, mHz, 10);
+    EdgeLog log = { 0, 0, 0, 0xFFFFFFFFu, 0 };
+    uint32_t secs = mHz < 1000 ? 60 : 10;
+    run(secs * DDS_TICK_HZ, log);
+    double ideal = (double)DDS_TICK_HZ * 1000.0 / mHz;   // Ticks per period
+    double got = secs * mHz / 1000.0;
+    printf("%7.3f Hz: %u rises (ideal %.2f), period %u..%u ticks (ideal %.2f), duty %.2f%%\n",
+           mHz / 1000.0, log.rises, got, log.minPeriod, log.maxPeriod, ideal,
+           100.0 * log.highTicks / (secs * DDS_TICK_HZ));
+    TEST_ASSERT_TRUE(fabs(log.rises - got) <= 1.0);
+    if (log.rises > 1) {
+      // One tick of edge jitter plus the ~5 uHz step of the phase increment
+      double slack = ideal * ideal * DDS_TICK_HZ / 4294967296.0;
+      TEST_ASSERT_TRUE(log.minPeriod >= (uint32_t)floor(ideal - slack));
+      TEST_ASSERT_TRUE(log.maxPeriod <= (uint32_t)ceil(ideal + slack));
+    }
+    TEST_ASSERT_TRUE(fabs(100.0 * log.highTicks / (secs * DDS_TICK_HZ) - 10.0) < 0.2);
+  }
+}
+
+// A change mid-period stretches or shrinks that one period toward the new
+// rate but never restarts it: no period shorter than the faster of the two
+static void test_phase_continuous(void) {
+  ddsAttach(eng, 0, 12);
+  ddsSet(eng, 0, 10000, 10);            // 10 Hz = 2000 ticks
+  EdgeLog log = { 0, 0, 0, 0xFFFFFFFFu, 0 };
+  run(3333, log);                       // Change lands mid-period
+  ddsSet(eng, 0, 12000, 10);            // 12 Hz = 1666.7 ticks
+  run(20000, log, 3333);
+  TEST_ASSERT_TRUE(log.minPeriod >= 1666);
+  TEST_ASSERT_TRUE(log.maxPeriod <= 2000);
+}
+
+static void test_detach_clears_pin(void) {
+  ddsAttach(eng, 0, 12);
+  ddsSet(eng, 0, 1000, 50);
+  uint64_t s, c;
+  ddsTick(eng, s, c);
+  TEST_ASSERT_TRUE((s) == (1ULL << 12));
+  ddsDetach(eng, 0);
+  ddsTick(eng, s, c);
+  TEST_ASSERT_TRUE((c) == (1ULL << 12));
+  TEST_ASSERT_TRUE((eng.level) == (0));
+}
+
+static void test_high_pins_and_off(void) {
+  ddsAttach(eng, 1, 33);
+  ddsSet(eng, 1, 5000, 100);
+  uint64_t s, c;
+  ddsTick(eng, s, c);
+  TEST_ASSERT_TRUE((s) == (1ULL << 33));
+  ddsSet(eng, 1, 0, 100);               // 0 mHz stops the output low
+  ddsTick(eng, s, c);
+  TEST_ASSERT_TRUE((c) == (1ULL << 33));
+}
+
+static void test_bench(void) {
+  for (int i = 0; i < DDS_MAX_OUTPUTS; i++) {
+    ddsAttach(eng, i, 12 + i);
+    ddsSet(eng, i, 1000 + i * 17000, 10 + i);
+  }
+  const uint32_t N = 20000000;
+  uint64_t acc = 0;
+  auto t0 = std::chrono::steady_clock::now();
+  for (uint32_t t = 0; t < N; t++) {
+    uint64_t s, c;
+    ddsTick(eng, s, c);
+    acc += s ^ c;
+  }
+  double ns = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - t0).count() / N;
+  printf("ddsTick %d outputs: %.1f ns/tick (host), budget %.0f ns at %d Hz  [%llu]\n",
+         DDS_MAX_OUTPUTS, ns, 1e9 / DDS_TICK_HZ, DDS_TICK_HZ, (unsigned long long)(acc & 1));
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_frequency_and_duty);
+  RUN_TEST(test_phase_continuous);
+  RUN_TEST(test_detach_clears_pin);
+  RUN_TEST(test_high_pins_and_off);
+  RUN_TEST(test_bench);
+  return UNITY_END();
+}
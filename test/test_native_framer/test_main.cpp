@@ -0,0 +1,121 @@
+// Host tests for the streaming NMEA framer: pio test -e native -f test_native_framer
+
+#include <unity.h>
+#include <string.h>
+#include "nmea_framer.h"
+#include "nmea_parser.h"
+
+// Feed a byte stream, collect the last completed line; returns lines completed
+static int feed(NmeaFramer& f, const char* bytes, char* last = nullptr) {
+  int lines = 0;
+  for (const char* p = bytes; *p; p++) {
+    if (f.push(*p)) {
+      lines++;
+      if (last) strcpy(last, f.line());
+    }
+  }
+  return lines;
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_valid_lines() {
+  NmeaFramer f;
+  char last[NMEA_LINE_MAX];
+  TEST_ASSERT_EQUAL_INT(2, feed(f, "$WIMWV,045.0,R,12.5,N,A*14\r\n$IIVWR,045.0,R,12.5,N,6.4,M,23.2,K*4F\r\n", last));
+  TEST_ASSERT_EQUAL_STRING("$IIVWR,045.0,R,12.5,N,6.4,M,23.2,K*4F", last);
+  TEST_ASSERT_TRUE(f.hadChecksum());
+  TEST_ASSERT_EQUAL_UINT32(2, f.stats.lines);
+}
+
+void test_split_across_chunks() {
+  NmeaFramer f;
+  char last[NMEA_LINE_MAX];
+  TEST_ASSERT_EQUAL_INT(0, feed(f, "$WIMWV,045.0,R,1"));
+  TEST_ASSERT_EQUAL_INT(1, feed(f, "2.5,N,A*14\n", last));
+  TEST_ASSERT_EQUAL_STRING("$WIMWV,045.0,R,12.5,N,A*14", last);
+}
+
+void test_no_checksum_accepted() {
+  NmeaFramer f;
+  TEST_ASSERT_EQUAL_INT(1, feed(f, "$WIMWV,045.0,R,12.5,N,A\n"));
+  TEST_ASSERT_FALSE(f.hadChecksum());
+}
+
+void test_bad_checksum_dropped() {
+  NmeaFramer f;
+  TEST_ASSERT_EQUAL_INT(1, feed(f, "$WIMWV,045.0,R,12.5,N,A*15\r\n$WIMWV,045.0,R,12.5,N,A*14\r\n"));
+  TEST_ASSERT_EQUAL_UINT32(1, f.stats.badChecksum);
+}
+
+void test_overrun_dropped_and_resyncs() {
+  NmeaFramer f;
+  char longLine[400] = "$WIMWV,";
+  memset(longLine + 7, 'x', 300);
+  longLine[307] = '\n';
+  longLine[308] = 0;
+  TEST_ASSERT_EQUAL_INT(0, feed(f, longLine));
+  TEST_ASSERT_EQUAL_UINT32(1, f.stats.overruns);
+  TEST_ASSERT_EQUAL_INT(1, feed(f, "$WIMWV,045.0,R,12.5,N,A*14\n"));
+}
+
+void test_lost_eol_restarts() {
+  NmeaFramer f;
+  char last[NMEA_LINE_MAX];
+  TEST_ASSERT_EQUAL_INT(1, feed(f, "$WIMWV,04$WIMWV,045.0,R,12.5,N,A*14\n", last));
+  TEST_ASSERT_EQUAL_STRING("$WIMWV,045.0,R,12.5,N,A*14", last);
+  TEST_ASSERT_EQUAL_UINT32(1, f.stats.corrupted);
+}
+
+void test_end_of_packet_finishes_line() {
+  NmeaFramer f;
+  TEST_ASSERT_EQUAL_INT(0, feed(f, "$WIMWV,045.0,R,12.5,N,A*14"));
+  TEST_ASSERT_TRUE(f.endOfPacket());
+  TEST_ASSERT_EQUAL_STRING("$WIMWV,045.0,R,12.5,N,A*14", f.line());
+  TEST_ASSERT_EQUAL_INT(0, feed(f, "$WIMWV,045.0,R,12.5,N,A*1"));
+  TEST_ASSERT_FALSE(f.endOfPacket());          // Partial line is not spliced
+  TEST_ASSERT_EQUAL_INT(0, feed(f, "4\n"));
+}
+
+// Framed lines skip the parser's checksum pass but parse to the same sample
+void test_framed_parse_matches_full_parse() {
+  const char* lines[] = {
+    "$WIMWV,045.0,R,12.5,N,A*14\r\n",
+    "$IIVWR,045.0,R,12.5,N,6.4,M,23.2,K*4F\r\n",
+    "$WIMWV,359.6,R,,N,A\r\n",
+    "$GPGGA,123519,6009.123,N,02457.456,E,1,08,0.9,545.4,M,46.9,M,,*49\r\n",
+  };
+  for (const char* in : lines) {
+    NmeaFramer f;
+    char last[NMEA_LINE_MAX] = "";
+    TEST_ASSERT_EQUAL_INT(1, feed(f, in, last));
+    WindSample a = {}, b = {};
+    NmeaParseResult ra = nmeaParse(last, strlen(last), a);
+    NmeaParseResult rb = nmeaParseFramed(f.line(), f.length(), b);
+    TEST_ASSERT_EQUAL(ra, rb);
+    TEST_ASSERT_EQUAL_INT(a.angleCdeg, b.angleCdeg);
+    TEST_ASSERT_EQUAL(a.hasSpeed, b.hasSpeed);
+  }
+}
+
+// The framer's verdict wins: a truncated "*1" trailer never reaches the parser
+void test_truncated_checksum_dropped_before_parse() {
+  NmeaFramer f;
+  TEST_ASSERT_EQUAL_INT(0, feed(f, "$WIMWV,045.0,R,12.5,N,A*1\r\n"));
+  TEST_ASSERT_EQUAL_UINT32(1, f.stats.corrupted);
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_valid_lines);
+  RUN_TEST(test_split_across_chunks);
+  RUN_TEST(test_no_checksum_accepted);
+  RUN_TEST(test_bad_checksum_dropped);
+  RUN_TEST(test_overrun_dropped_and_resyncs);
+  RUN_TEST(test_lost_eol_restarts);
+  RUN_TEST(test_end_of_packet_finishes_line);
+  RUN_TEST(test_framed_parse_matches_full_parse);
+  RUN_TEST(test_truncated_checksum_dropped_before_parse);
+  return UNITY_END();
+}
@@ -0,0 +1,60 @@
+// Host tests for the latency histograms: pio test -e native -f test_native_latency_hist
+
+#include <unity.h>
+#include "latency_hist.h"
+
+void setUp() {}
+void tearDown() {}
+
+void test_bucket_edges() {
+  for (uint32_t v = 0; v < 100000; v++) {
+    uint32_t b = histBucket(v);
+    TEST_ASSERT_TRUE(histBucketLow(b) <= v);
+    TEST_ASSERT_TRUE(histBucketLow(b + 1) > v);
+  }
+  TEST_ASSERT_EQUAL_UINT32(HIST_BUCKETS - 1, histBucket(UINT32_MAX));
+}
+
+void test_summary_values() {
+  LatencyHist h;
+  for (uint32_t v = 1; v <= 1000; v++) h.record(v);
+  LatencySummary s = h.summary();
+  TEST_ASSERT_EQUAL_UINT32(1000, s.count);
+  TEST_ASSERT_EQUAL_UINT32(1, s.min);
+  TEST_ASSERT_EQUAL_UINT32(1000, s.max);
+  TEST_ASSERT_EQUAL_UINT32(500, s.avg);
+  // Bucket upper edges: within 25% above the exact percentile
+  TEST_ASSERT_TRUE(s.p50 >= 500 && s.p50 <= 625);
+  TEST_ASSERT_TRUE(s.p99 >= 990 && s.p99 <= 1000);
+}
+
+void test_outlier_shows_in_p99_not_p50() {
+  LatencyHist h;
+  for (int i = 0; i < 990; i++) h.record(200);
+  for (int i = 0; i < 10; i++) h.record(50000);
+  LatencySummary s = h.summary();
+  TEST_ASSERT_TRUE(s.p50 >= 200 && s.p50 < 250);
+  TEST_ASSERT_TRUE(s.p99 >= 200 && s.p99 < 250);
+  h.record(50000);
+  TEST_ASSERT_TRUE(h.percentile(99) >= 40000);
+  TEST_ASSERT_EQUAL_UINT32(50000, h.summary().max);
+}
+
+void test_reset_and_empty() {
+  LatencyHist h;
+  h.record(7);
+  h.reset();
+  LatencySummary s = h.summary();
+  TEST_ASSERT_EQUAL_UINT32(0, s.count);
+  TEST_ASSERT_EQUAL_UINT32(0, s.min);
+  TEST_ASSERT_EQUAL_UINT32(0, s.p99);
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_bucket_edges);
+  RUN_TEST(test_summary_values);
+  RUN_TEST(test_outlier_shows_in_p99_not_p50);
+  RUN_TEST(test_reset_and_empty);
+  return UNITY_END();
+}
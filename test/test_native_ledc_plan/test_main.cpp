@@ -0,0 +1,75 @@
+// Host model of the fractional LEDC path: pio test -e native -f test_native_ledc_plan
+//
+// Sweeps 0..fmax for a few sumlogK values and compares the frequency the LEDC
+// timer would really run at (divider and resolution from ledcPlanFor) with
+// the exact K * speed, next to the whole-Hz path it replaces.
+
+#include <unity.h>
+#include <math.h>
+#include <stdio.h>
+#include "ledc_plan.h"
+#include "pulse_driver.h"
+
+void setUp(void) {}
+void tearDown(void) {}
+
+static void test_plan_limits(void) {
+  LedcPlan p;
+  TEST_ASSERT_FALSE(ledcPlanFor(0, 10, p));
+  TEST_ASSERT_FALSE(ledcPlanFor(70, 10, p));          // 0.07 Hz: below 20-bit range
+  TEST_ASSERT_TRUE(ledcPlanFor(75, 10, p));
+  TEST_ASSERT_EQUAL_UINT8(20, p.bits);
+  TEST_ASSERT_TRUE(ledcPlanFor(150000, 10, p));       // 150 Hz
+  TEST_ASSERT_EQUAL_UINT8(10, p.bits);
+  TEST_ASSERT_TRUE(p.divQ8 >= LEDC_PLAN_DIV_MIN && p.divQ8 <= LEDC_PLAN_DIV_MAX);
+  TEST_ASSERT_FALSE(ledcPlanFor(80000000u, 10, p));   // 80 kHz: needs < 10 bits
+}
+
+static void test_duty(void) {
+  LedcPlan p = { 0x10000, 16 };
+  TEST_ASSERT_EQUAL_UINT32(6553, ledcPlanDuty(p, 10));
+  TEST_ASSERT_EQUAL_UINT32(65535, ledcPlanDuty(p, 100));
+}
+
+// Achieved vs wanted over the whole speed range of a display
+static void test_sweep_error(void) {
+  const float ks[] = { 0.1f, 0.5f, 1.0f, 2.37f };
+  const int fmax = 150;
+  for (float k : ks) {
+    PulseDriver d;
+    pulseDriverResolve(d, "sumlog", k, fmax, 10, 10);
+    double worstFrac = 0, worstInt = 0;
+    int below = 0;
+    for (int i = 1; i <= 100000; i++) {
+      float speed = i * 0.001f;                       // 0.001..100 kn
+      double want = fmin((double)speed * k, (double)fmax);
+      if (want < 0.01) continue;
+      uint32_t mHz = d.freqMilliHz(d, speed);
+      LedcPlan p;
+      if (!ledcPlanFor(mHz, 10, p)) {
+        TEST_ASSERT_TRUE(want < 0.0755);              // Only the bottom of the LEDC range is lost
+        below++;
+        continue;
+      }
+      TEST_ASSERT_TRUE(p.bits >= 10);
+      double got = ledcPlanHz(p);
+      double errFrac = fabs(got - want) / want;
+      double errInt = fabs((double)pulseRoundHz(mHz) - want) / want;
+      // mHz quantisation (<= 0.5 mHz) plus a 10.8 divider step (<= 4 ppm)
+      TEST_ASSERT_TRUE(fabs(got - want) <= 0.0005 + want * 5e-6 + want * 1e-6);
+      if (errFrac > worstFrac) worstFrac = errFrac;
+      if (errInt > worstInt) worstInt = errInt;
+    }
+    printf("K=%.2f  worst error frac %.4f%%  int %.1f%%  (%d samples below 0.075 Hz)\n",
+           k, worstFrac * 100, worstInt * 100, below);
+    TEST_ASSERT_TRUE(worstFrac < 0.01);               // < 1 %; near 0.075 Hz one mHz alone is 0.7 %
+  }
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_plan_limits);
+  RUN_TEST(test_duty);
+  RUN_TEST(test_sweep_error);
+  return UNITY_END();
+}
@@ -0,0 +1,89 @@
+// Host tests for the deferred logger: pio test -e native -f test_native_log_ring
+
+#include <unity.h>
+#include <thread>
+#include <string.h>
+#include "log_ring.h"
+
+void setUp() {}
+void tearDown() {
+  LogRecord r;
+  while (logRing.pop(r)) {}
+  logRing.dropped = 0;
+}
+
+static const char* popFormatted(char* buf, size_t size) {
+  LogRecord r;
+  if (!logRing.pop(r)) return nullptr;
+  logFormat(r, buf, size);
+  return buf;
+}
+
+void test_format_matches_printf() {
+  char buf[128];
+  LOG_INFO("Display %d freq=%uHz (speed=%.1f kn)", 2, 37u, 12.46f);
+  TEST_ASSERT_EQUAL_STRING("Display 2 freq=37Hz (speed=12.5 kn)", popFormatted(buf, sizeof(buf)));
+  static const char host[] = "192.168.4.1";
+  LOG_WARN("TCP connect to %s:%u... 100%%", host, 6666u);
+  TEST_ASSERT_EQUAL_STRING("TCP connect to 192.168.4.1:6666... 100%", popFormatted(buf, sizeof(buf)));
+  LOG_INFO("%lu ms, 0x%02X, %5d|", 12345ul, 0x5Fu, -7);
+  TEST_ASSERT_EQUAL_STRING("12345 ms, 0x5F,    -7|", popFormatted(buf, sizeof(buf)));
+  LOG_INFO("plain");
+  TEST_ASSERT_EQUAL_STRING("plain", popFormatted(buf, sizeof(buf)));
+}
+
+void test_format_truncates() {
+  char buf[8];
+  LOG_INFO("value=%d", 123456);
+  TEST_ASSERT_EQUAL_STRING("value=1", popFormatted(buf, sizeof(buf)));
+}
+
+void test_overflow_drops_and_counts() {
+  for (int i = 0; i < LOG_RING_SLOTS + 5; i++) LOG_ERROR("n=%d", i);
+  TEST_ASSERT_EQUAL_UINT32(5, logRing.dropped.load());
+  char buf[16];
+  TEST_ASSERT_EQUAL_STRING("n=0", popFormatted(buf, sizeof(buf)));   // Oldest kept
+}
+
+void test_debug_compiled_out() {
+#if LOG_LEVEL < LOG_LEVEL_DEBUG
+  LOG_DEBUG("never %d", 1);
+  LogRecord r;
+  TEST_ASSERT_FALSE(logRing.pop(r));
+#endif
+}
+
+void test_concurrent_producers() {
+  const int perThread = 20000;
+  std::atomic<int> got{0};
+  std::atomic<bool> done{false};
+  std::thread consumer([&]() {
+    LogRecord r;
+    for (;;) {
+      bool finished = done;          // Read before popping so nothing is missed
+      if (logRing.pop(r)) {
+        if (r.nargs == 2 && r.args[1].i == r.args[0].i * 2) got++;
+      } else if (finished) {
+        break;
+      }
+    }
+  });
+  std::thread a([&]() { for (int i = 0; i < perThread; i++) LOG_INFO("%d %d", i, i * 2); });
+  std::thread b([&]() { for (int i = 0; i < perThread; i++) LOG_INFO("%d %d", i, i * 2); });
+  a.join();
+  b.join();
+  done = true;
+  consumer.join();
+  // Every record is either delivered intact or counted as dropped
+  TEST_ASSERT_EQUAL_INT(2 * perThread, got.load() + (int)logRing.dropped.load());
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_format_matches_printf);
+  RUN_TEST(test_format_truncates);
+  RUN_TEST(test_overflow_drops_and_counts);
+  RUN_TEST(test_debug_compiled_out);
+  RUN_TEST(test_concurrent_producers);
+  return UNITY_END();
+}
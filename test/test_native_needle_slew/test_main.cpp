@@ -0,0 +1,61 @@
+// Host check for the needle slew interpolation: pio test -e native -f test_native_needle_slew
+//
+// The output task steps the needle with needleStepCdeg() once per tick, with
+// the step from slewStepCdeg() at its current rate, and jumps from
+// NEEDLE_UNSET after boot or once the angle watchdog clears.
+
+#include <unity.h>
+#include "needle_slew.h"
+
+void setUp() {}
+void tearDown() {}
+
+void test_slew_shortest_way() {
+  TEST_ASSERT_EQUAL_INT(1500, slewTowardCdeg(1000, 9000, 500));
+  TEST_ASSERT_EQUAL_INT(9000, slewTowardCdeg(8800, 9000, 500));     // Lands exactly
+  TEST_ASSERT_EQUAL_INT(35700, slewTowardCdeg(200, 34000, 500));    // Through 0, not round
+  TEST_ASSERT_EQUAL_INT(100, slewTowardCdeg(35800, 100, 500));
+  TEST_ASSERT_EQUAL_INT(18000, angleDiffCdeg(0, 18000));
+  TEST_ASSERT_EQUAL_INT(36000, slewStepCdeg(0, 200));              // 0 = jump
+  TEST_ASSERT_EQUAL_INT(90, slewStepCdeg(180, 200));
+  TEST_ASSERT_EQUAL_INT(1, slewStepCdeg(1, 500));
+}
+
+// Unset needle goes straight to the target, whatever the step
+void test_jump_from_unset() {
+  TEST_ASSERT_EQUAL_INT(27000, needleStepCdeg(NEEDLE_UNSET, 27000, 1));
+  TEST_ASSERT_EQUAL_INT(0, needleStepCdeg(NEEDLE_UNSET, 0, 90));
+  TEST_ASSERT_EQUAL_INT(35999, needleStepCdeg(NEEDLE_UNSET, 35999, 90));
+  // From then on it slews, starting from the jumped-to angle
+  int32_t n = needleStepCdeg(NEEDLE_UNSET, 100, 90);
+  n = needleStepCdeg(n, 35900, 90);
+  TEST_ASSERT_EQUAL_INT(10, n);
+  // Zero is a real angle, not the sentinel
+  TEST_ASSERT_EQUAL_INT(90, needleStepCdeg(0, 9000, 90));
+}
+
+// At the fastest tick rate the step still gives the configured speed
+void test_step_at_max_rate() {
+  int32_t step = slewStepCdeg(SLEW_DPS_DEFAULT, OUTPUT_RATE_HZ_MAX);
+  TEST_ASSERT_EQUAL_INT(36, step);
+  // Half a turn takes one second at 180 deg/s
+  int32_t n = 0;
+  int ticks = 0;
+  while (n != 18000 && ticks < 10 * OUTPUT_RATE_HZ_MAX) {
+    n = needleStepCdeg(n, 18000, step);
+    ticks++;
+  }
+  TEST_ASSERT_EQUAL_INT(OUTPUT_RATE_HZ_MAX, ticks);
+  // Slow limits clamp to 1 cdeg per tick (5 deg/s at 500 Hz), never stall
+  TEST_ASSERT_EQUAL_INT(1, slewStepCdeg(1, OUTPUT_RATE_HZ_MAX));
+  TEST_ASSERT_EQUAL_INT(1, slewStepCdeg(5, OUTPUT_RATE_HZ_MAX));
+  TEST_ASSERT_EQUAL_INT(36000, slewStepCdeg(0, OUTPUT_RATE_HZ_MAX));
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_slew_shortest_way);
+  RUN_TEST(test_jump_from_unset);
+  RUN_TEST(test_step_at_max_rate);
+  return UNITY_END();
+}
@@ -0,0 +1,179 @@
+// Host benchmark for the NMEA wind parser: pio test -e native -f test_native_parser_bench
+//
+// Reports sentences/s and ns/sentence for a few corpora shaped like what a
+// boat multiplexer sends. Each corpus is parsed once for correctness before
+// timing so a "fast" parser that drops sentences can't look good here.
+
+#include <unity.h>
+#include <chrono>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "nmea_parser.h"
+
+struct Corpus {
+  const char* name;
+  const char* const* lines;
+  size_t count;
+  size_t expectWind;   // lines that must parse as wind sentences
+};
+
+static const char* const kMwvOnly[] = {
+  "$WIMWV,045.0,R,12.5,N,A*14",
+  "$WIMWV,312.4,R,8.2,N,A*2D",
+  "$WIMWV,180.0,T,21.0,N,A*1F",
+  "$IIMWV,001.5,R,0.4,N,A*3D",
+};
+
+static const char* const kWindMixed[] = {
+  "$WIMWV,045.0,R,12.5,N,A*14",
+  "$IIVWR,045.0,R,12.5,N,6.4,M,23.2,K*4F",
+  "$IIVWT,120.0,L,15.0,N,7.7,M,27.8,K*5B",
+  "$WIMWV,180.0,T,21.0,N,A*1F",
+};
+
+// Typical 38400-baud multiplexer: wind mixed into GPS, heading, depth and AIS
+static const char* const kMuxMixed[] = {
+  "$GPRMC,123519,A,6009.123,N,02457.456,E,5.4,084.4,230394,003.1,W*61",
+  "$WIMWV,045.0,R,12.5,N,A*14",
+  "$GPGGA,123519,6009.123,N,02457.456,E,1,08,0.9,545.4,M,46.9,M,,*49",
+  "$HCHDG,101.1,,,7.1,W*3C",
+  "$IIVWR,045.0,R,12.5,N,6.4,M,23.2,K*4F",
+  "$GPGLL,6009.123,N,02457.456,E,123519,A,A*46",
+  "$SDDPT,4.3,0.5*55",
+  "!AIVDM,1,1,,A,13aEOK?P00PD2wVMdLDRhgvL289?,0*26",
+  "$IIVWT,120.0,L,15.0,N,7.7,M,27.8,K*5B",
+  "$GPVTG,084.4,T,,M,5.4,N,10.0,K,A*35",
+};
+
+#define CORPUS(n, a, w) { n, a, sizeof(a) / sizeof(a[0]), w }
+
+static const Corpus kCorpora[] = {
+  CORPUS("MWV only",    kMwvOnly,   4),
+  CORPUS("wind mixed",  kWindMixed, 4),
+  CORPUS("mux mixed",   kMuxMixed,  3),
+};
+
+static const size_t kIterations = 200000;
+
+static size_t countWind(const Corpus& c) {
+  size_t ok = 0;
+  WindSample s;
+  for (size_t i = 0; i < c.count; i++) {
+    if (parseNMEALine(c.lines[i], s)) ok++;
+  }
+  return ok;
+}
+
+static void benchCorpus(const Corpus& c) {
+  TEST_ASSERT_EQUAL_UINT32(c.expectWind, countWind(c));
+
+  size_t bytes = 0;
+  for (size_t i = 0; i < c.count; i++) bytes += strlen(c.lines[i]) + 2;  // + CR/LF
+
+  volatile int sink = 0;
+  WindSample s;
+  auto t0 = std::chrono::steady_clock::now();
+  for (size_t it = 0; it < kIterations; it++) {
+    for (size_t i = 0; i < c.count; i++) {
+      if (parseNMEALine(c.lines[i], s)) sink += s.angleDeg;
+    }
+  }
+  auto t1 = std::chrono::steady_clock::now();
+  (void)sink;
+
+  double ns = std::chrono::duration<double, std::nano>(t1 - t0).count();
+  double sentences = (double)kIterations * c.count;
+  double nsPer = ns / sentences;
+  // 38400 baud, 8N1 = 3840 bytes/s on the wire
+  double wireRate = 3840.0 / ((double)bytes / c.count);
+
+  char msg[160];
+  snprintf(msg, sizeof(msg), "%-11s %9.0f sentences/s  %7.1f ns/sentence  (38400 baud = %.0f sentences/s)",
+           c.name, 1e9 / nsPer, nsPer, wireRate);
+  TEST_MESSAGE(msg);
+}
+
+void setUp() {}
+void tearDown() {}
+
+void test_parse_values() {
+  WindSample s;
+  TEST_ASSERT_TRUE(parseNMEALine("$WIMWV,045.0,R,12.5,N,A*14", s));
+  TEST_ASSERT_EQUAL(NMEA_KIND_MWV_R, s.kind);
+  TEST_ASSERT_EQUAL_INT(45, s.angleDeg);
+  TEST_ASSERT_TRUE(s.hasSpeed);
+  TEST_ASSERT_FLOAT_WITHIN(0.001f, 12.5f, s.speedKn);
+
+  TEST_ASSERT_TRUE(parseNMEALine("$IIVWT,120.0,L,15.0,N,7.7,M,27.8,K*5B", s));
+  TEST_ASSERT_EQUAL(NMEA_KIND_VWT, s.kind);
+  TEST_ASSERT_EQUAL_INT(240, s.angleDeg);
+  TEST_ASSERT_EQUAL_INT(24000, s.angleCdeg);
+
+  // Sub-degree angle is kept in centidegrees
+  const char* frac = "$WIMWV,312.47,R,8.2,N,A";
+  TEST_ASSERT_EQUAL(NMEA_OK, nmeaParse(frac, strlen(frac), s));
+  TEST_ASSERT_EQUAL_INT(31247, s.angleCdeg);
+  TEST_ASSERT_EQUAL_INT(312, s.angleDeg);
+  const char* left = "$IIVWR,012.37,L,5.0,N";
+  TEST_ASSERT_EQUAL(NMEA_OK, nmeaParse(left, strlen(left), s));
+  TEST_ASSERT_EQUAL_INT(34763, s.angleCdeg);
+  TEST_ASSERT_EQUAL_INT(348, s.angleDeg);
+
+  TEST_ASSERT_FALSE(parseNMEALine("$GPGLL,6009.123,N,02457.456,E,123519,A,A*46", s));
+}
+
+void test_parse_results() {
+  WindSample s;
+  const char* bad = "$WIMWV,045.0,R,12.5,N,A*15";
+  TEST_ASSERT_EQUAL(NMEA_BAD_CHECKSUM, nmeaParse(bad, strlen(bad), s));
+  const char* lower = "$wimwv,045.0,r,12.5,n,a*14";   // lower-case formatter is not ours
+  TEST_ASSERT_EQUAL(NMEA_UNKNOWN_TYPE, nmeaParse(lower, strlen(lower), s));
+  const char* gga = "$GPGGA,123519,6009.123,N,02457.456,E,1,08,0.9,545.4,M,46.9,M,,*49";
+  TEST_ASSERT_EQUAL(NMEA_UNKNOWN_TYPE, nmeaParse(gga, strlen(gga), s));
+  const char* noAngle = "$WIMWV,,R,12.5,N,A";
+  TEST_ASSERT_EQUAL(NMEA_MALFORMED, nmeaParse(noAngle, strlen(noAngle), s));
+  const char* tooBig = "$WIMWV,361.0,R,12.5,N,A";
+  TEST_ASSERT_EQUAL(NMEA_MALFORMED, nmeaParse(tooBig, strlen(tooBig), s));
+  TEST_ASSERT_EQUAL(NMEA_NOT_NMEA, nmeaParse("WIMWV,1", 7, s));
+
+  // No checksum and lower-case hex are both accepted
+  TEST_ASSERT_TRUE(parseNMEALine("$WIMWV,359.6,R,,N,A", s));
+  TEST_ASSERT_EQUAL_INT(0, s.angleDeg);
+  TEST_ASSERT_FALSE(s.hasSpeed);
+  TEST_ASSERT_TRUE(parseNMEALine("$IIVWR,045.0,R,12.5,N,6.4,M,23.2,K*4f", s));
+}
+
+// Fixed-point rounding must give the same whole degrees as lroundf(atof())
+void test_fixed_matches_atof() {
+  char buf[16];
+  for (int cdeg = 0; cdeg <= 36000; cdeg++) {
+    for (int extra = 0; extra < 10; extra += 4) {
+      snprintf(buf, sizeof(buf), "%d.%02d%d", cdeg / 100, cdeg % 100, extra);
+      int32_t v;
+      TEST_ASSERT_TRUE(nmeaParseFixed(buf, strlen(buf), 2, v));
+      TEST_ASSERT_EQUAL_INT((int)lroundf(atof(buf)), (v + 50) / 100);
+    }
+  }
+  int32_t v;
+  TEST_ASSERT_FALSE(nmeaParseFixed("", 0, 2, v));
+  TEST_ASSERT_FALSE(nmeaParseFixed("1.2.3", 5, 2, v));
+  TEST_ASSERT_TRUE(nmeaParseFixed("7", 1, 2, v));
+  TEST_ASSERT_EQUAL_INT(700, v);
+}
+
+void test_bench_corpora() {
+  for (size_t i = 0; i < sizeof(kCorpora) / sizeof(kCorpora[0]); i++) {
+    benchCorpus(kCorpora[i]);
+  }
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_parse_values);
+  RUN_TEST(test_parse_results);
+  RUN_TEST(test_fixed_matches_atof);
+  RUN_TEST(test_bench_corpora);
+  return UNITY_END();
+}
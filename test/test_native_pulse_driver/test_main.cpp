@@ -0,0 +1,177 @@
+// Host check for the resolved pulse drivers: pio test -e native -f test_native_pulse_driver
+//
+// freqMilliHz() rounded to whole Hz must give what the old strcmp branches in
+// updateDisplayPulse did: K pulses per knot, capped at fmax, 0 = output off.
+// Also the hysteresis band that keeps gust noise from reprogramming the timer.
+
+#include <unity.h>
+#include <math.h>
+#include <stdio.h>
+#include "pulse_driver.h"
+
+#define PULSE_HYST_TEST 10  // PULSE_HYST_DEFAULT in web_ui.h
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// Verbatim math of the old per-type branches
+static uint32_t oldFreq(float speed, float k, int fmax) {
+  if (speed < 0.01f) return 0;
+  float freq = speed * k;
+  if (freq > (float)fmax) freq = (float)fmax;
+  if (freq < 0.01f) return 0;
+  return (uint32_t)(freq + 0.5f);
+}
+
+static void test_type_names(void) {
+  TEST_ASSERT_EQUAL(DISPLAY_TYPE_SUMLOG, displayTypeFromName("sumlog"));
+  TEST_ASSERT_EQUAL(DISPLAY_TYPE_LOGICWIND, displayTypeFromName("logicwind"));
+  TEST_ASSERT_EQUAL(DISPLAY_TYPE_NONE, displayTypeFromName("Sumlog"));
+  TEST_ASSERT_EQUAL(DISPLAY_TYPE_NONE, displayTypeFromName(""));
+  TEST_ASSERT_EQUAL_STRING("logicwind", displayTypeName(DISPLAY_TYPE_LOGICWIND));
+}
+
+static void test_matches_old_math(void) {
+  const char* types[] = { "sumlog", "logicwind" };
+  const float ks[] = { 1.0f, 2.5f, 0.37f, 10.0f };
+  const int fmaxes[] = { 150, 20, 1, 0 };
+  for (const char* t : types)
+    for (float k : ks)
+      for (int fmax : fmaxes) {
+        PulseDriver d;
+        pulseDriverResolve(d, t, k, fmax, 10, 10);
+        for (int i = 0; i <= 8000; i++) {
+          float speed = i * 0.01f;
+          uint32_t mHz = d.freqMilliHz(d, speed);
+          float exact = speed >= 0.01f ? fminf(speed * k, (float)fmax) : 0.0f;
+          TEST_ASSERT_UINT32_WITHIN(1, (uint32_t)(exact * 1000.0f + 0.5f), mHz);
+          // Rounding via mHz may differ only right at a half-Hz boundary
+          if (fabsf(exact - floorf(exact) - 0.5f) > 0.001f)
+            TEST_ASSERT_EQUAL_UINT32(oldFreq(speed, k, fmax), pulseRoundHz(mHz));
+        }
+      }
+}
+
+static void test_unknown_type_is_off(void) {
+  PulseDriver d;
+  pulseDriverResolve(d, "analog", 1.0f, 150, 10, 10);
+  TEST_ASSERT_EQUAL(DISPLAY_TYPE_NONE, d.type);
+  TEST_ASSERT_EQUAL_UINT32(0, d.freqMilliHz(d, 12.0f));
+}
+
+static void test_duty_count(void) {
+  PulseDriver d;
+  pulseDriverResolve(d, "sumlog", 1.0f, 150, 10, 10);
+  TEST_ASSERT_EQUAL_UINT32((1023 * 10) / 100, d.dutyCount);
+  pulseDriverResolve(d, "sumlog", 1.0f, 150, 150, 10);
+  TEST_ASSERT_EQUAL_UINT32(1023, d.dutyCount);
+  pulseDriverResolve(d, "sumlog", 1.0f, 150, -5, 10);
+  TEST_ASSERT_EQUAL_UINT32(0, d.dutyCount);
+}
+
+static void test_hysteresis_band(void) {
+  TEST_ASSERT_FALSE(pulseOutsideBand(100000, 100400, 5));   // 0.4 % < 0.5 %
+  TEST_ASSERT_TRUE(pulseOutsideBand(100000, 100600, 5));
+  TEST_ASSERT_TRUE(pulseOutsideBand(100000, 99400, 5));
+  TEST_ASSERT_TRUE(pulseOutsideBand(0, 1, 100));            // Start always passes
+  TEST_ASSERT_TRUE(pulseOutsideBand(1, 0, 100));            // ...and stop
+  TEST_ASSERT_TRUE(pulseOutsideBand(1000, 1001, 0));
+  TEST_ASSERT_FALSE(pulseOutsideBand(1000, 1000, 0));
+}
+
+// Gusty 10 kn +-1.5 kn with +-0.1 kn noise, updated every 50 ms for 10 min.
+// Models the timer as updateDisplayPulse drives it: `commanded` is lastFreq,
+// the band is checked against it, and a change either restarts the counter
+// now (immediate) or, while running, is queued like ledcPending and written
+// by the overflow ISR when the running period ends. A newer queued value
+// replaces an older one. Counts reprograms, periods cut short by a counter
+// restart, and the longest a queued value waited compared to the period it
+// waited on (must stay <= 1).
+struct GustResult {
+  uint32_t reprograms, runts, deferred;
+  double worstErr, worstWait;
+};
+
+static GustResult gustRun(uint16_t band, bool atPeriodEnd) {
+  PulseDriver d;
+  pulseDriverResolve(d, "sumlog", 5.0f, 150, 10, 10);
+  GustResult r = {};
+  uint32_t seed = 12345, commanded = 0, active = 0, pending = 0;
+  double phase = 0;                 // Fraction of the running period elapsed
+  double waited = 0;                // Seconds the pending value has been queued
+  for (int step = 0; step < 12000; step++) {
+    seed = seed * 1103515245u + 12345u;
+    float noise = ((seed >> 16) & 0x7FFF) / 32768.0f - 0.5f;
+    float speed = 10.0f + 1.5f * sinf(step * 0.01f) + noise * 0.2f;
+    uint32_t want = d.freqMilliHz(d, speed);
+    if (pulseOutsideBand(commanded, want, band)) {
+      commanded = want;
+      if (atPeriodEnd && active) {
+        if (!pending) waited = 0;
+        pending = want;             // Overflow ISR writes it
+        r.deferred++;
+      } else {
+        if (active && phase > 0) r.runts++;   // Counter reset mid-period
+        r.reprograms++;
+        phase = 0;
+        pending = 0;
+        active = want;
+      }
+    }
+    if (commanded) {
+      double e = fabs((double)commanded - want) / commanded;
+      if (e > r.worstErr) r.worstErr = e;
+    }
+    // Run the timer for 50 ms, one period boundary at a time
+    double t = 0.05;
+    while (active && t > 0) {
+      double left = (1.0 - phase) * 1000.0 / active;   // Seconds to overflow
+      if (left > t) {
+        phase += t * active / 1000.0;
+        if (pending) waited += t;
+        break;
+      }
+      t -= left;
+      phase += left * active / 1000.0;   // Overflow
+      if (pending) {
+        double w = (waited + left) * active / 1000.0;  // In periods of the old rate
+        if (w > r.worstWait) r.worstWait = w;
+        if (phase < 1.0 - 1e-9) r.runts++;
+        r.reprograms++;
+        active = pending;
+        pending = 0;
+      }
+      phase = 0;
+    }
+  }
+  return r;
+}
+
+static void test_gust_churn(void) {
+  GustResult now = gustRun(0, false);
+  GustResult end = gustRun(PULSE_HYST_TEST, true);
+  printf("no band, immediate:  %u reprograms, %u cut periods\n", now.reprograms, now.runts);
+  printf("%u permille, period end: %u queued, %u reprograms, %u cut periods, "
+         "longest wait %.2f periods, worst error %.2f%%\n", PULSE_HYST_TEST, end.deferred,
+         end.reprograms, end.runts, end.worstWait, end.worstErr * 100);
+  TEST_ASSERT_TRUE(now.runts > 0);
+  TEST_ASSERT_TRUE(end.deferred > 0);
+  // Queued values land on a boundary, never later than the end of the period running
+  TEST_ASSERT_EQUAL_UINT32(0, end.runts);
+  TEST_ASSERT_TRUE(end.worstWait > 0 && end.worstWait <= 1.0 + 1e-9);
+  // Every write is the start or an ISR apply; a value replaced in the queue is never written
+  TEST_ASSERT_TRUE(end.reprograms <= end.deferred + 1);
+  TEST_ASSERT_TRUE(end.reprograms * 4 < now.reprograms);
+  TEST_ASSERT_TRUE(end.worstErr <= PULSE_HYST_TEST / 1000.0 + 1e-6);
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_type_names);
+  RUN_TEST(test_matches_old_math);
+  RUN_TEST(test_unknown_type_is_off);
+  RUN_TEST(test_duty_count);
+  RUN_TEST(test_hysteresis_band);
+  RUN_TEST(test_gust_churn);
+  return UNITY_END();
+}
@@ -0,0 +1,52 @@
+// Host tests for the seqlock snapshot: pio test -e native -f test_native_seqlock
+
+#include <unity.h>
+#include <thread>
+#include <atomic>
+#include "seqlock.h"
+
+struct Pair {
+  uint32_t a;
+  uint32_t b;      // Always a * 3 when not torn
+  char pad[120];
+};
+
+void setUp() {}
+void tearDown() {}
+
+void test_read_after_write() {
+  Seqlock<Pair> s;
+  uint32_t v0 = s.version();
+  s.update([](Pair& p) { p.a = 7; p.b = 21; });
+  Pair p = s.read();
+  TEST_ASSERT_EQUAL_UINT32(7, p.a);
+  TEST_ASSERT_EQUAL_UINT32(21, p.b);
+  TEST_ASSERT_TRUE(s.version() != v0);
+}
+
+void test_concurrent_reads_never_torn() {
+  Seqlock<Pair> s;
+  std::atomic<bool> stop{false};
+  std::thread writer([&]() {
+    for (uint32_t i = 1; i < 200000; i++) {
+      s.update([i](Pair& p) { p.a = i; memset(p.pad, (int)i, sizeof(p.pad)); p.b = i * 3; });
+    }
+    stop = true;
+  });
+  uint32_t torn = 0, reads = 0;
+  while (!stop) {
+    Pair p = s.read();
+    if (p.b != p.a * 3 || (p.a && p.pad[119] != (char)p.a)) torn++;
+    reads++;
+  }
+  writer.join();
+  TEST_ASSERT_EQUAL_UINT32(0, torn);
+  TEST_ASSERT_TRUE(reads > 0);
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_read_after_write);
+  RUN_TEST(test_concurrent_reads_never_torn);
+  return UNITY_END();
+}
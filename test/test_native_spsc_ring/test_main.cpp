@@ -0,0 +1,49 @@
+// Host tests for the SPSC ring: pio test -e native -f test_native_spsc_ring
+
+#include <unity.h>
+#include "spsc_ring.h"
+
+void setUp() {}
+void tearDown() {}
+
+void test_fifo_order() {
+  SpscRing<int, 4> r;
+  int v;
+  TEST_ASSERT_FALSE(r.pop(v));
+  for (int i = 0; i < 3; i++) TEST_ASSERT_TRUE(r.push(i));
+  for (int i = 0; i < 3; i++) {
+    TEST_ASSERT_TRUE(r.pop(v));
+    TEST_ASSERT_EQUAL_INT(i, v);
+  }
+  TEST_ASSERT_FALSE(r.pop(v));
+}
+
+void test_full_drops_and_counts() {
+  SpscRing<int, 4> r;
+  for (int i = 0; i < 4; i++) TEST_ASSERT_TRUE(r.push(i));
+  TEST_ASSERT_FALSE(r.push(99));
+  TEST_ASSERT_EQUAL_UINT32(1, r.dropped.load());
+  TEST_ASSERT_EQUAL_UINT32(4, r.size());
+  int v;
+  TEST_ASSERT_TRUE(r.pop(v));
+  TEST_ASSERT_EQUAL_INT(0, v);             // Oldest kept, newest dropped
+}
+
+void test_index_wraparound() {
+  SpscRing<int, 2> r;
+  int v;
+  for (int i = 0; i < 1000; i++) {
+    TEST_ASSERT_TRUE(r.push(i));
+    TEST_ASSERT_TRUE(r.pop(v));
+    TEST_ASSERT_EQUAL_INT(i, v);
+  }
+  TEST_ASSERT_EQUAL_UINT32(0, r.size());
+}
+
+int main(int, char**) {
+  UNITY_BEGIN();
+  RUN_TEST(test_fifo_order);
+  RUN_TEST(test_full_drops_and_counts);
+  RUN_TEST(test_index_wraparound);
+  return UNITY_END();
+}
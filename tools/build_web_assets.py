@@ -0,0 +1,125 @@
+"""Pack web/ into gzip-compressed PROGMEM assets: src/web_assets.h/.cpp
+
+Runs before every PlatformIO build (extra_scripts = pre:...) and can be run
+by hand for Arduino IDE builds: python3 tools/build_web_assets.py
+
+  web/*.css, web/*.js  -> /a/<hash>/<name>, cached for a year (immutable)
+  web/*.html           -> served at the route given in PAGES, ETag + no-cache
+  web/_*.html          -> partials; also emitted as plain PROGMEM strings for
+                          pages that are still built in C++
+
+{{name}} is replaced by the hashed URL of asset `name`;
+<!--#include _part.html--> pulls in a partial.
+"""
+import gzip
+import hashlib
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+WEB = os.path.join(ROOT, "web")
+OUT_H = os.path.join(ROOT, "src", "web_assets.h")
+OUT_CPP = os.path.join(ROOT, "src", "web_assets.cpp")
+
+PAGES = {"status.html": "/"}     # Static pages and their routes
+TYPES = {".css": "text/css", ".js": "application/javascript", ".html": "text/html"}
+
+
+def ident(name):
+    return "WEB_" + re.sub(r"[^A-Za-z0-9]", "_", name.lstrip("_")).upper()
+
+
+def short_hash(data):
+    return hashlib.sha256(data).hexdigest()[:8]
+
+
+def c_bytes(data):
+    rows = []
+    for i in range(0, len(data), 20):
+        rows.append("  " + ",".join("0x%02x" % b for b in data[i:i + 20]))
+    return ",\n".join(rows)
+
+
+def c_string(text):
+    out = []
+    for line in text.split("\n"):
+        line = line.replace("\\", "\\\\").replace('"', '\\"')
+        out.append('  "%s\\n"' % line)
+    return "\n".join(out[:-1] if text.endswith("\n") else out)
+
+
+def build():
+    files = sorted(f for f in os.listdir(WEB) if os.path.splitext(f)[1] in TYPES)
+    read = lambda f: open(os.path.join(WEB, f), encoding="utf-8").read()
+
+    # Hashed URLs for CSS/JS first; HTML refers to them
+    urls = {}
+    statics = []
+    for f in files:
+        if f.endswith(".html"):
+            continue
+        raw = read(f).encode("utf-8")
+        urls[f] = "/a/%s/%s" % (short_hash(raw), f)
+        statics.append((f, urls[f], raw, True))
+
+    def expand(text):
+        text = re.sub(r"<!--#include (\S+)-->\n?", lambda m: expand(read(m.group(1))), text)
+        return re.sub(r"\{\{(\S+?)\}\}", lambda m: urls[m.group(1)], text)
+
+    partials = [(f, expand(read(f))) for f in files if f.startswith("_")]
+    for f, route in PAGES.items():
+        statics.append((f, route, expand(read(f)).encode("utf-8"), False))
+
+    h = ["// Generated by tools/build_web_assets.py from web/ - do not edit", "#pragma once",
+         "#include <Arduino.h>", "",
+         "struct WebAsset {",
+         "  const char* path;        // Route",
+         "  const char* type;",
+         "  const uint8_t* gz;       // gzip body, PROGMEM",
+         "  uint32_t gzLen;",
+         "  uint32_t rawLen;         // Uncompressed size",
+         "  const char* etag;",
+         "  bool immutable;          // Hashed URL: cache for a year",
+         "};", ""]
+    for f, url in sorted(urls.items()):
+        h.append('#define %s_URL "%s"' % (ident(f), url))
+    h.append("")
+    for f, _ in partials:
+        h.append("extern const char %s[] PROGMEM;" % ident(f))
+    h += ["", "extern const WebAsset WEB_ASSETS[];", "extern const size_t WEB_ASSET_COUNT;", ""]
+
+    cpp = ["// Generated by tools/build_web_assets.py from web/ - do not edit",
+           '#include "web_assets.h"', ""]
+    table = []
+    total_raw = total_gz = 0
+    for f, route, raw, immutable in statics:
+        gz = gzip.compress(raw, 9, mtime=0)
+        total_raw += len(raw)
+        total_gz += len(gz)
+        name = ident(f) + "_GZ"
+        cpp.append("static const uint8_t %s[] PROGMEM = {\n%s\n};" % (name, c_bytes(gz)))
+        etag = '\\"%s\\"' % short_hash(gz)
+        table.append('  { "%s", "%s", %s, %d, %d, "%s", %s },' % (
+            route, TYPES[os.path.splitext(f)[1]], name, len(gz), len(raw), etag,
+            "true" if immutable else "false"))
+        print("web asset %-14s %6d -> %5d bytes gzip  %s" % (f, len(raw), len(gz), route))
+    cpp.append("")
+    for f, text in partials:
+        cpp.append("const char %s[] PROGMEM =\n%s;" % (ident(f), c_string(text)))
+    cpp += ["", "const WebAsset WEB_ASSETS[] = {"] + table + ["};",
+            "const size_t WEB_ASSET_COUNT = sizeof(WEB_ASSETS) / sizeof(WEB_ASSETS[0]);", ""]
+    print("web assets total %d -> %d bytes" % (total_raw, total_gz))
+
+    for path, lines in ((OUT_H, h), (OUT_CPP, cpp)):
+        text = "\n".join(lines)
+        if not os.path.exists(path) or open(path, encoding="utf-8").read() != text:
+            open(path, "w", encoding="utf-8").write(text)
+
+
+build()
+
+try:
+    Import("env")  # noqa: F821 - defined when run as a PlatformIO extra script
+except NameError:
+    pass
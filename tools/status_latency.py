@@ -0,0 +1,61 @@
+#!/usr/bin/env python3
+"""Compare /status latency with and without the NVS reads.
+
+/status is served from the RAM config snapshot; /status?nvs=1 re-reads the
+settings from NVS first, as every request did before. Both are timed on the
+device (stages "status" and "status_nvs" on /timing). This clears the
+histograms, sends the same number of requests to each path and prints the
+device-side p50/p99 next to the client round trip.
+
+  python3 tools/status_latency.py 192.168.4.1 [-n 200]
+"""
+
+import argparse
+import json
+import statistics
+import time
+import urllib.request
+
+
+def get(base, path):
+    with urllib.request.urlopen(base + path, timeout=5) as r:
+        return r.read()
+
+
+def round_trips(base, path, n):
+    ms = []
+    for _ in range(n):
+        t0 = time.perf_counter()
+        get(base, path)
+        ms.append((time.perf_counter() - t0) * 1000.0)
+    return ms
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    ap.add_argument("host", help="adapter address, e.g. 192.168.4.1")
+    ap.add_argument("-n", type=int, default=200, help="requests per path")
+    args = ap.parse_args()
+    base = "http://" + args.host
+
+    get(base, "/timing?reset=1")
+    rtt = {
+        "status": round_trips(base, "/status", args.n),
+        "status_nvs": round_trips(base, "/status?nvs=1", args.n),
+    }
+    timing = json.loads(get(base, "/timing"))
+    stages = {s["name"]: s for s in timing["stages"]}
+
+    print("%-11s %6s %9s %9s %9s %12s" % ("path", "count", "p50 us", "p99 us", "max us", "rtt p50 ms"))
+    for name in ("status_nvs", "status"):
+        s = stages.get(name)
+        if s is None:
+            print("%-11s  not reported by this firmware" % name)
+            continue
+        print("%-11s %6d %9.1f %9.1f %9.1f %12.1f" % (
+            name, s["count"], s["p50_us"], s["p99_us"], s["max_us"],
+            statistics.median(rtt[name])))
+
+
+if __name__ == "__main__":
+    main()
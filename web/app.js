@@ -0,0 +1,99 @@
+// Highlight the tab of the current page
+document.querySelectorAll('.nav a').forEach(a => {
+  if (a.getAttribute('href') === location.pathname) a.classList.add('active');
+});
+
+let typing = false;
+async function refresh(){
+  try{
+    const r = await fetch('/api/telemetry'); const j = await r.json();
+    // Update common status elements if they exist
+    const rawEl = document.getElementById('raw');
+    const angEl = document.getElementById('ang');
+    const spdEl = document.getElementById('spd');
+    const sentenceTypesEl = document.getElementById('sentence_types');
+    
+    // Legacy elements
+    const staIpEl = document.getElementById('sta_ip');
+    const apSsidEl = document.getElementById('ap_ssid');
+    const apIpEl = document.getElementById('ap_ip');
+    const tcpStateEl = document.getElementById('tcp_state');
+    
+    // New structured status elements
+    const staSsidNameEl = document.getElementById('sta_ssid_name');
+    const staStatusEl = document.getElementById('sta_status');
+    const apSsidNameEl = document.getElementById('ap_ssid_name');
+    const apStatusEl = document.getElementById('ap_status');
+    const nmeaProtocolEl = document.getElementById('nmea_protocol');
+    const nmeaPortEl = document.getElementById('nmea_port');
+    const nmeaHostEl = document.getElementById('nmea_host');
+    const nmeaStatusEl = document.getElementById('nmea_status');
+    
+    if (rawEl) rawEl.textContent = j.raw || "-";
+    if (angEl) angEl.textContent = j.angle;
+    if (spdEl) spdEl.textContent = j.speed_kn.toFixed(2);
+    
+    // Build sentence types list
+    if (sentenceTypesEl) {
+      let types = [];
+      if (j.has_mwv_r) types.push("MWV(R)");
+      if (j.has_mwv_t) types.push("MWV(T)");
+      if (j.has_vwr) types.push("VWR");
+      if (j.has_vwt) types.push("VWT");
+      sentenceTypesEl.textContent = types.length > 0 ? types.join(", ") : "waiting...";
+    }
+    
+    // Legacy status (for compatibility)
+    if (staIpEl) staIpEl.textContent = j.sta_ip || "-";
+    if (apSsidEl) apSsidEl.textContent = j.ap_ssid || "-";
+    if (apIpEl) apIpEl.textContent = j.ap_ip || "-";
+    if (tcpStateEl) tcpStateEl.textContent = j.tcp_connected ? "connected" : "disconnected";
+    
+    // New structured status
+    if (staSsidNameEl) staSsidNameEl.textContent = j.sta_ssid || "not configured";
+    if (staStatusEl) {
+      const connected = j.sta_connected;
+      const ip = j.sta_ip;
+      staStatusEl.textContent = connected ? `Connected (${ip})` : "Disconnected";
+      staStatusEl.style.color = connected ? "#28a745" : "#dc3545";
+    }
+    
+    if (apSsidNameEl) apSsidNameEl.textContent = j.ap_ssid || "VDO-Cal";
+    if (apStatusEl) {
+      const clients = j.ap_clients || 0;
+      const clientText = clients === 0 ? "no clients" : `${clients} client${clients > 1 ? 's' : ''}`;
+      apStatusEl.textContent = `Active (${clientText})`;
+      apStatusEl.style.color = "#28a745";
+    }
+    
+    if (nmeaProtocolEl) {
+      if (j.proto === "TCP") {
+        nmeaProtocolEl.textContent = "TCP (client)";
+      } else if (j.proto === "HTTP") {
+        nmeaProtocolEl.textContent = "HTTP (client)";
+      } else {
+        nmeaProtocolEl.textContent = "UDP (listening)";
+      }
+    }
+    if (nmeaPortEl) nmeaPortEl.textContent = j.port || "10110";
+    if (nmeaHostEl) nmeaHostEl.textContent = j.host || "192.168.4.2";
+    if (nmeaStatusEl) {
+      if (j.proto === "TCP") {
+        const connected = j.tcp_connected;
+        nmeaStatusEl.textContent = connected ? "Connected" : "Disconnected";
+        nmeaStatusEl.style.color = connected ? "#28a745" : "#dc3545";
+      } else {
+        // UDP: Check if data is actually coming in (within last 5 seconds)
+        const dataAge = j.nmea_data_age || 999999;
+        const dataActive = dataAge < 5000;
+        nmeaStatusEl.textContent = dataActive ? "Active (data flowing)" : "Ready for data";
+        nmeaStatusEl.style.color = dataActive ? "#28a745" : "#ffc107";
+      }
+    }
+  }catch(e){}
+}
+
+window.addEventListener('load', () => {
+  refresh(); 
+  setInterval(refresh, 800);
+});
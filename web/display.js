@@ -0,0 +1,93 @@
+
+function updateDisplayFields() {
+  const enabled = document.getElementById('displayEnabled').checked;
+  const type = document.getElementById('displayType').value;
+  
+  // Basic config rows (Meter Type, NMEA Sentence): show only when enabled
+  const configRows = document.querySelectorAll('.display_config_row');
+  configRows.forEach(row => {
+    row.style.display = enabled ? '' : 'none';
+  });
+  
+  // 1. WIND DIRECTION: Show only for Logic Wind type when enabled
+  const showDirection = (enabled && type === 'logicwind');
+  document.getElementById('wind_direction_header').style.display = showDirection ? '' : 'none';
+  document.getElementById('logicwind_direction_fields').style.display = showDirection ? '' : 'none';
+  
+  // 2. PULSE: Show always when enabled
+  const showPulse = enabled;
+  document.getElementById('pulse_fields').style.display = showPulse ? '' : 'none';
+}
+
+async function setDisplayEnabled(){ 
+  const enabled = document.getElementById('displayEnabled').checked;
+  await fetch('/api/display?num=' + DISPLAY_NUM + '&action=enabled&val=' + (enabled?1:0));
+  updateDisplayFields();
+  setTimeout(refresh,150);
+}
+
+async function saveDisplaySettings(){
+  const enabled = document.getElementById('displayEnabled').checked;
+  const type = document.getElementById('displayType').value;
+  const sentence = document.getElementById('displaySentence').value;
+  const offsetDeg = document.getElementById('offsetDeg').value;
+  const gotoAngle = document.getElementById('gotoAngle').value;
+  const sumlogK = document.getElementById('sumlogK').value;
+  const sumlogFmax = document.getElementById('sumlogFmax').value;
+  const pulseDuty = document.getElementById('pulseDuty').value;
+  const pulsePin = document.getElementById('pulsePin').value;
+  const dacAddr = document.getElementById('dacAddr').value;
+  
+  // Save all settings in one request
+  const params = new URLSearchParams({
+    enabled: enabled?1:0,
+    type: type,
+    sentence: sentence,
+    offsetDeg: offsetDeg,
+    gotoAngle: gotoAngle,
+    sumlogK: sumlogK,
+    sumlogFmax: sumlogFmax,
+    pulseDuty: pulseDuty,
+    pulsePin: pulsePin,
+    dacAddr: dacAddr
+  });
+  
+  await fetch('/api/display?num=' + DISPLAY_NUM + '&action=save', {
+    method: 'POST',
+    headers: {'Content-Type': 'application/x-www-form-urlencoded'},
+    body: params
+  });
+  
+  setTimeout(refresh,150);
+}
+
+async function goAngle(){ 
+  const v = document.getElementById('gotoAngle').value;
+  await fetch('/goto?deg='+encodeURIComponent(v)); 
+  setTimeout(refresh,150); 
+}
+
+// Load current display values
+async function loadDisplayValues() {
+  try {
+    const r = await fetch('/api/display?num=' + DISPLAY_NUM); 
+    const j = await r.json();
+    
+    document.getElementById('displayEnabled').checked = j.enabled || false;
+    document.getElementById('displayType').value = j.type || "sumlog";
+    document.getElementById('displaySentence').value = j.sentence || "MWV";
+    document.getElementById('offsetDeg').value = j.offsetDeg || 0;
+    document.getElementById('gotoAngle').value = j.gotoAngle || 0;
+    document.getElementById('sumlogK').value = j.sumlogK || 1.0;
+    document.getElementById('sumlogFmax').value = j.sumlogFmax || 150;
+    document.getElementById('pulseDuty').value = j.pulseDuty || 10;
+    document.getElementById('pulsePin').value = j.pulsePin || (12 + DISPLAY_NUM * 2);
+    document.getElementById('dacAddr').value = j.dacAddr ? '0x' + j.dacAddr.toString(16).toUpperCase() : '0';
+    
+    updateDisplayFields();
+  } catch(e) {}
+}
+
+window.addEventListener('load', () => {
+  loadDisplayValues();
+});